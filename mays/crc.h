@@ -8,6 +8,39 @@
 #include <cstddef>
 #include <cstdint>
 
+// Instruction set extensions are available for x86-64 targets using GNU-compatible compilers, which
+// can compile code paths for CPUs determined to support them at run time.
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
+// Carry-less multiplication (PCLMULQDQ) folding for any CRC model.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(MAYS_CRC_DISABLE_CLMUL)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define MAYS_CRC_HAS_CLMUL 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define MAYS_CRC_HAS_CLMUL 0
+#endif
+
+// SSE4.2 CRC32 instruction for CRC-32C models.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(MAYS_CRC_DISABLE_SSE42)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define MAYS_CRC_HAS_SSE42 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define MAYS_CRC_HAS_SSE42 0
+#endif
+
+// SSSE3 byte shuffles for verifying batches of records of models up to 16 bits wide.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(MAYS_CRC_DISABLE_SSSE3)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define MAYS_CRC_HAS_SSSE3 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define MAYS_CRC_HAS_SSSE3 0
+#endif
+
 namespace mays {
 namespace detail {
 
@@ -95,8 +128,463 @@ template <typename T, size_t BitWidth>
   }
 }
 
+#if MAYS_CRC_HAS_CLMUL
+// Multipliers for folding message data into a CRC using carry-less multiplication, following "Fast
+// CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Vinodh Gopal et al., 2009)
+// accessed at https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/fast-crc-computation-generic-polynomials-pclmulqdq-paper.pdf
+//
+// To support any polynomial width up to 64 with one implementation, the degree-|BitWidth|
+// polynomial P(x) is scaled up to P'(x) = P(x)·x**(64 - BitWidth), which has degree 64. For any
+// message M(x), M(x)·x**64 mod P'(x) is then (M(x)·x**BitWidth mod P(x))·x**(64 - BitWidth), so a
+// reflected 64-bit remainder for P' is identical to the reflected |BitWidth|-bit remainder for P.
+//
+// All multipliers are stored reflected (highest-power coefficient in the ones position), as
+// message data is folded in the "reflected world" (Williams) regardless of the CRC's orientation.
+struct ClmulFoldConstants {
+  // x**(512 + 64 - 1) mod P' and x**(512 - 1) mod P', for folding the two halves of a 128-bit
+  // accumulator across 512 bits of message. Each is one power lower than the fold distance
+  // because the product of two reflected operands is itself reflected, but one position low.
+  uint64_t fold_512_high;
+  uint64_t fold_512_low;
+
+  // x**(128 + 64 - 1) mod P' and x**(128 - 1) mod P', for folding across 128 bits.
+  uint64_t fold_128_high;
+  uint64_t fold_128_low;
+
+  // Coefficients of floor(x**128 / P') below x**64 (the Barrett reduction constant μ).
+  uint64_t quotient;
+
+  // Coefficients of P' below x**64.
+  uint64_t polynomial;
+};
+
+// Computes the multipliers for a polynomial of |BitWidth| bits written higher-power-left with the
+// (implicit) x**BitWidth coefficient omitted.
+template <size_t BitWidth>
+[[nodiscard]] constexpr ClmulFoldConstants MakeClmulFoldConstants(uint64_t polynomial) {
+  static_assert(BitWidth <= 64);
+  const uint64_t scaled_polynomial = polynomial << (64 - BitWidth);
+
+  // Computes x**power mod P' by repeatedly multiplying by x (a left shift) and subtracting P'
+  // whenever the x**64 coefficient would be set.
+  auto power_of_x_mod_polynomial = [scaled_polynomial](size_t power) {
+    uint64_t remainder = 1;
+    for (size_t i = 0; i < power; i++) {
+      const bool subtract = (remainder >> 63) != 0;
+      remainder <<= 1;
+      if (subtract) {
+        remainder ^= scaled_polynomial;
+      }
+    }
+    return ReflectBits(remainder);
+  };
+
+  // Long division of x**128 by P'. Each step multiplies the previous dividend x**(64 + i) by x,
+  // which adds a quotient term whenever the x**63 coefficient of the previous remainder was set.
+  // The initial x**64 quotient term is shifted out of the 64-bit register by the end.
+  uint64_t quotient = 1;
+  uint64_t remainder = scaled_polynomial;
+  for (size_t i = 0; i < 64; i++) {
+    const bool subtract = (remainder >> 63) != 0;
+    quotient = (quotient << 1) | uint64_t{subtract};
+    remainder <<= 1;
+    if (subtract) {
+      remainder ^= scaled_polynomial;
+    }
+  }
+
+  return {
+      .fold_512_high = power_of_x_mod_polynomial(512 + 64 - 1),
+      .fold_512_low = power_of_x_mod_polynomial(512 - 1),
+      .fold_128_high = power_of_x_mod_polynomial(128 + 64 - 1),
+      .fold_128_low = power_of_x_mod_polynomial(128 - 1),
+      .quotient = ReflectBits(quotient),
+      .polynomial = ReflectBits(scaled_polynomial),
+  };
+}
+
+// Returns true if the CPU executing this code supports the instructions used by |ClmulFold|.
+[[nodiscard]] inline bool CpuSupportsClmul() {
+  return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+}
+
+// Loads 16 octets of message data. If |ReflectOctets| is true, then the bits of each octet are
+// reversed in order to process message bits MSb-first.
+template <bool ReflectOctets>
+[[nodiscard]] __attribute__((target("pclmul,ssse3"))) inline __m128i ClmulLoad(
+    const uint8_t* data) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  if constexpr (ReflectOctets) {
+    // Look up the reversal of each nibble and swap the nibbles of each octet.
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    // NOLINTNEXTLINE(readability-magic-numbers)
+    const __m128i reversed_nibbles = _mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9,
+                                                   0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+    const __m128i low_nibbles = _mm_and_si128(block, nibble_mask);
+    const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(block, 4), nibble_mask);
+    return _mm_or_si128(_mm_slli_epi16(_mm_shuffle_epi8(reversed_nibbles, low_nibbles), 4),
+                        _mm_shuffle_epi8(reversed_nibbles, high_nibbles));
+  } else {
+    return block;
+  }
+}
+
+// Multiplies the higher-power (low) and lower-power (high) halves of |accumulator| by the
+// respective halves of |multipliers|, which moves the accumulator's contents forward by the
+// multipliers' distance. Adds the result to |block|, which lies at that distance.
+[[nodiscard]] __attribute__((target("pclmul,ssse3"))) inline __m128i ClmulFoldBlock(
+    __m128i accumulator,
+    __m128i multipliers,
+    __m128i block) {
+  const __m128i high_product = _mm_clmulepi64_si128(accumulator, multipliers, 0x00);
+  const __m128i low_product = _mm_clmulepi64_si128(accumulator, multipliers, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(high_product, low_product), block);
+}
+
+// Returns the 128-bit carry-less product of |a| and |b|.
+[[nodiscard]] __attribute__((target("pclmul,ssse3"))) inline __m128i ClmulMultiply(uint64_t a,
+                                                                                    uint64_t b) {
+  return _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<int64_t>(a)),
+                              _mm_cvtsi64_si128(static_cast<int64_t>(b)), 0x00);
+}
+
+// Computes the reflected remainder of P' (see |ClmulFoldConstants|) after processing |length|
+// octets of |data| starting from the reflected remainder |remainder|. |length| must be a multiple
+// of 16 and no less than 64. If |ReflectOctets| is true, then the bits of each octet are reversed
+// before being folded, in order to process message bits MSb-first.
+template <bool ReflectOctets>
+[[nodiscard]] __attribute__((target("pclmul,ssse3"))) inline uint64_t ClmulFold(
+    uint64_t remainder,
+    const uint8_t* data,
+    size_t length,
+    const ClmulFoldConstants& constants) {
+  constexpr size_t kBlockSize = sizeof(__m128i);
+  auto make_multipliers = [](uint64_t high, uint64_t low) {
+    return _mm_set_epi64x(static_cast<int64_t>(low), static_cast<int64_t>(high));
+  };
+
+  // Message data lives in the "reflected world," where the first octet in memory has the highest
+  // power, so adding the remainder to the leading message bits is a plain XOR.
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  __m128i accumulators[4] = {
+      _mm_xor_si128(ClmulLoad<ReflectOctets>(data),
+                    _mm_cvtsi64_si128(static_cast<int64_t>(remainder))),
+      ClmulLoad<ReflectOctets>(data + kBlockSize), ClmulLoad<ReflectOctets>(data + 2 * kBlockSize),
+      ClmulLoad<ReflectOctets>(data + 3 * kBlockSize)};
+  data += 4 * kBlockSize;
+  length -= 4 * kBlockSize;
+
+  // Four independent accumulators hide the latency of the multiplier.
+  const __m128i fold_512 = make_multipliers(constants.fold_512_high, constants.fold_512_low);
+  for (; length >= 4 * kBlockSize; length -= 4 * kBlockSize) {
+    for (__m128i& accumulator : accumulators) {
+      accumulator = ClmulFoldBlock(accumulator, fold_512, ClmulLoad<ReflectOctets>(data));
+      data += kBlockSize;
+    }
+  }
+
+  // Combine the accumulators then fold any remaining data.
+  const __m128i fold_128 = make_multipliers(constants.fold_128_high, constants.fold_128_low);
+  __m128i accumulator = ClmulFoldBlock(accumulators[0], fold_128, accumulators[1]);
+  accumulator = ClmulFoldBlock(accumulator, fold_128, accumulators[2]);
+  accumulator = ClmulFoldBlock(accumulator, fold_128, accumulators[3]);
+  for (; length >= kBlockSize; length -= kBlockSize) {
+    accumulator = ClmulFoldBlock(accumulator, fold_128, ClmulLoad<ReflectOctets>(data));
+    data += kBlockSize;
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  // The remainder for the message is that of the 128-bit accumulator with 64 zero bits appended.
+  // Fold its higher-power half forward by 128 bits (i.e. 64 past its end) and add in the
+  // lower-power half shifted by 64 bits, leaving a 128-bit dividend D(x) = H(x)·x**64 + L(x).
+  const __m128i dividend = _mm_xor_si128(_mm_clmulepi64_si128(accumulator, fold_128, 0x10),
+                                         _mm_srli_si128(accumulator, 8));
+  const auto dividend_high = static_cast<uint64_t>(_mm_cvtsi128_si64(dividend));
+  const auto dividend_low = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_srli_si128(dividend, 8)));
+
+  // Barrett reduction: the quotient floor(H(x)·x**64 / P') is floor(H(x)·μ / x**64). As μ's x**64
+  // coefficient is implicit, this is H(x) plus the higher-power half of H(x) multiplied by the rest
+  // of μ. Reflected products are one position low, so shift them up by one position to compensate.
+  const __m128i quotient_product = ClmulMultiply(dividend_high, constants.quotient);
+  const uint64_t quotient =
+      dividend_high ^ (static_cast<uint64_t>(_mm_cvtsi128_si64(quotient_product)) << 1);
+
+  // The remainder is L(x) minus the lower-power half of the quotient times P', to which only the
+  // lower-power half of P' contributes.
+  const __m128i product = ClmulMultiply(quotient, constants.polynomial);
+  const auto product_high = static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+  const auto product_low = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_srli_si128(product, 8)));
+  return dividend_low ^ (product_low << 1) ^ (product_high >> 63);
+}
+#endif  // MAYS_CRC_HAS_CLMUL
+
+#if MAYS_CRC_HAS_SSE42
+// Returns true if the CPU executing this code supports the SSE4.2 CRC32 instruction.
+[[nodiscard]] inline bool CpuSupportsSse42() {
+  return __builtin_cpu_supports("sse4.2");
+}
+
+// Computes the reflected CRC-32C (Castagnoli) remainder after processing |length| octets of |data|
+// starting from the reflected remainder |remainder|, using the SSE4.2 CRC32 instruction.
+[[nodiscard]] __attribute__((target("sse4.2"))) inline uint32_t Sse42Crc32c(uint32_t remainder,
+                                                                             const uint8_t* data,
+                                                                             size_t length) {
+  uint64_t remainder_64 = remainder;
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    __builtin_memcpy(&word, data, sizeof(word));
+    remainder_64 = _mm_crc32_u64(remainder_64, word);
+  }
+  // Process the rest in at most three steps instead of one octet at a time, for short messages.
+  auto remainder_32 = static_cast<uint32_t>(remainder_64);
+  if ((length & 4) != 0) {
+    uint32_t word = 0;
+    __builtin_memcpy(&word, data, sizeof(word));
+    remainder_32 = _mm_crc32_u32(remainder_32, word);
+    data += sizeof(word);
+  }
+  if ((length & 2) != 0) {
+    uint16_t word = 0;
+    __builtin_memcpy(&word, data, sizeof(word));
+    remainder_32 = _mm_crc32_u16(remainder_32, word);
+    data += sizeof(word);
+  }
+  if ((length & 1) != 0) {
+    remainder_32 = _mm_crc32_u8(remainder_32, *data);
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return remainder_32;
+}
+
+// Computes the reflected CRC-32C remainder after processing the |OctetCount| lowest octets of
+// |word|, least-significant first, starting from the reflected remainder |remainder|.
+template <size_t OctetCount>
+[[nodiscard]] __attribute__((target("sse4.2"))) inline uint32_t Sse42Crc32cWord(uint32_t remainder,
+                                                                                 uint64_t word) {
+  if constexpr (OctetCount == 8) {
+    return static_cast<uint32_t>(_mm_crc32_u64(remainder, word));
+  } else {
+    if constexpr ((OctetCount & 4) != 0) {
+      remainder = _mm_crc32_u32(remainder, static_cast<uint32_t>(word));
+      word >>= 32;
+    }
+    if constexpr ((OctetCount & 2) != 0) {
+      remainder = _mm_crc32_u16(remainder, static_cast<uint16_t>(word));
+      word >>= 16;
+    }
+    if constexpr ((OctetCount & 1) != 0) {
+      remainder = _mm_crc32_u8(remainder, static_cast<uint8_t>(word));
+    }
+    return remainder;
+  }
+}
+
+// Computes the reflected CRC-32C remainders of three consecutive |block_length|-octet blocks of
+// |data|, starting from |remainder| for the first and from zero for the other two. The CRC32
+// instruction's latency is several times its reciprocal throughput, so interleaving the three
+// independent streams keeps it fully occupied. |block_length| must be a multiple of 8.
+[[nodiscard]] __attribute__((target("sse4.2"))) inline auto Sse42Crc32cInterleaved(
+    uint32_t remainder,
+    const uint8_t* data,
+    size_t block_length) {
+  struct Remainders {
+    uint32_t first;
+    uint32_t second;
+    uint32_t third;
+  };
+  uint64_t first = remainder;
+  uint64_t second = 0;
+  uint64_t third = 0;
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  auto load = [](const uint8_t* octets) {
+    uint64_t word = 0;
+    __builtin_memcpy(&word, octets, sizeof(word));
+    return word;
+  };
+  for (const uint8_t* end = data + block_length; data < end; data += sizeof(uint64_t)) {
+    first = _mm_crc32_u64(first, load(data));
+    second = _mm_crc32_u64(second, load(data + block_length));
+    third = _mm_crc32_u64(third, load(data + 2 * block_length));
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  return Remainders{static_cast<uint32_t>(first), static_cast<uint32_t>(second),
+                    static_cast<uint32_t>(third)};
+}
+#endif  // MAYS_CRC_HAS_SSE42
+
+#if MAYS_CRC_HAS_SSSE3
+// Returns true if the CPU executing this code supports the instructions used by
+// |Ssse3NibbleRemainders|.
+[[nodiscard]] inline bool CpuSupportsSsse3() {
+  return __builtin_cpu_supports("ssse3");
+}
+
+// Bytes of the remainders for each value of the high and low nibbles of a dividend octet, as
+// 16-entry byte shuffles. Remainders up to 16 bits wide are split into a leading byte, which is
+// added to the next octet of message data, and a trailing byte (zero for widths up to 8 bits).
+struct CrcNibbleShuffles {
+  // NOLINTBEGIN(modernize-avoid-c-arrays)
+  alignas(16) uint8_t leading_high[16];
+  alignas(16) uint8_t leading_low[16];
+  alignas(16) uint8_t trailing_high[16];
+  alignas(16) uint8_t trailing_low[16];
+  // NOLINTEND(modernize-avoid-c-arrays)
+};
+
+// Processes one octet of message data for each of 16 remainders held as byte planes (see
+// |Ssse3NibbleRemainders|). The remainder of the dividend octet is the sum of the remainders of its
+// two nibbles, each looked up by a byte shuffle for all 16 lanes at once.
+template <bool HasTrailingBytes>
+__attribute__((target("ssse3"))) inline void Ssse3NibbleStep(__m128i octets,
+                                                             const CrcNibbleShuffles& shuffles,
+                                                             __m128i& leading,
+                                                             __m128i& trailing) {
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+  const __m128i dividends = _mm_xor_si128(octets, leading);
+  const __m128i high = _mm_and_si128(_mm_srli_epi16(dividends, 4), nibble_mask);
+  const __m128i low = _mm_and_si128(dividends, nibble_mask);
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  const auto* const leading_high = reinterpret_cast<const __m128i*>(shuffles.leading_high);
+  const auto* const leading_low = reinterpret_cast<const __m128i*>(shuffles.leading_low);
+  leading = _mm_xor_si128(_mm_shuffle_epi8(_mm_load_si128(leading_high), high),
+                          _mm_shuffle_epi8(_mm_load_si128(leading_low), low));
+  if constexpr (HasTrailingBytes) {
+    // The trailing byte becomes the leading byte after the octet is shifted in.
+    leading = _mm_xor_si128(leading, trailing);
+    const auto* const trailing_high = reinterpret_cast<const __m128i*>(shuffles.trailing_high);
+    const auto* const trailing_low = reinterpret_cast<const __m128i*>(shuffles.trailing_low);
+    trailing = _mm_xor_si128(_mm_shuffle_epi8(_mm_load_si128(trailing_high), high),
+                             _mm_shuffle_epi8(_mm_load_si128(trailing_low), low));
+  }
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+// Processes |payload_length| octets of each of 16 records of |record_length| octets at |records|
+// through their remainders. Lane i of |leading| and |trailing| hold the leading and trailing bytes
+// of the remainder of record i, which are updated in place. Each run of eight octets of the 16
+// records is transposed so that each vector holds the same octet of every record. Runs may extend
+// past the payloads into the rest of the records, but those octets are not processed.
+template <bool HasTrailingBytes>
+__attribute__((target("ssse3"))) inline void Ssse3NibbleRemainders(
+    const uint8_t* records,
+    size_t record_length,
+    size_t payload_length,
+    const CrcNibbleShuffles& shuffles,
+    uint8_t* leading,
+    uint8_t* trailing) {
+  constexpr size_t kLaneCount = 16;
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  // NOLINTBEGIN(modernize-avoid-c-arrays,cppcoreguidelines-pro-bounds-constant-array-index)
+  __m128i leading_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(leading));
+  __m128i trailing_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(trailing));
+  size_t offset = 0;
+  for (; offset < payload_length && offset + 8 <= record_length; offset += 8) {
+    // Pairs of records, with their octets interleaved.
+    __m128i pairs[8];
+    for (size_t i = 0; i < 8; i++) {
+      const uint8_t* const first = records + 2 * i * record_length + offset;
+      pairs[i] = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(first)),
+                                   _mm_loadl_epi64(
+                                       reinterpret_cast<const __m128i*>(first + record_length)));
+    }
+    // Quads of records, for octets 0-3 and 4-7.
+    __m128i quads[2][4];
+    for (size_t i = 0; i < 4; i++) {
+      quads[0][i] = _mm_unpacklo_epi16(pairs[2 * i], pairs[2 * i + 1]);
+      quads[1][i] = _mm_unpackhi_epi16(pairs[2 * i], pairs[2 * i + 1]);
+    }
+    // Each octet of all records.
+    __m128i columns[8];
+    for (size_t i = 0; i < 2; i++) {
+      // Octets 0-1 and 2-3 of the quads' range for records 0-7 and 8-15.
+      const __m128i first_low = _mm_unpacklo_epi32(quads[i][0], quads[i][1]);
+      const __m128i first_high = _mm_unpackhi_epi32(quads[i][0], quads[i][1]);
+      const __m128i second_low = _mm_unpacklo_epi32(quads[i][2], quads[i][3]);
+      const __m128i second_high = _mm_unpackhi_epi32(quads[i][2], quads[i][3]);
+      columns[4 * i] = _mm_unpacklo_epi64(first_low, second_low);
+      columns[4 * i + 1] = _mm_unpackhi_epi64(first_low, second_low);
+      columns[4 * i + 2] = _mm_unpacklo_epi64(first_high, second_high);
+      columns[4 * i + 3] = _mm_unpackhi_epi64(first_high, second_high);
+    }
+    const size_t column_count = payload_length - offset < 8 ? payload_length - offset : 8;
+    for (size_t i = 0; i < column_count; i++) {
+      Ssse3NibbleStep<HasTrailingBytes>(columns[i], shuffles, leading_bytes, trailing_bytes);
+    }
+  }
+  for (; offset < payload_length; offset++) {
+    alignas(16) uint8_t column[kLaneCount];
+    for (size_t lane = 0; lane < kLaneCount; lane++) {
+      column[lane] = records[lane * record_length + offset];
+    }
+    Ssse3NibbleStep<HasTrailingBytes>(_mm_load_si128(reinterpret_cast<const __m128i*>(column)),
+                                      shuffles,
+                                      leading_bytes,
+                                      trailing_bytes);
+  }
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(leading), leading_bytes);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(trailing), trailing_bytes);
+  // NOLINTEND(modernize-avoid-c-arrays,cppcoreguidelines-pro-bounds-constant-array-index)
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+#endif  // MAYS_CRC_HAS_SSSE3
+
 }  // namespace detail
 
+// Selects the look-up tables that Crc uses to process octet-aligned message data, which trades
+// table memory for throughput.
+//
+// Table memory is given in entries, each of which is the size of the model's register type. Tables
+// are generated at compile time and only those for the selected policy are emitted.
+enum class CrcTablePolicy {
+  // No tables. Each message bit is shifted through the feedback register individually.
+  kBitwise,
+  // Two tables of 16 remainders, one for each nibble of an octet, processing an octet per pair of
+  // look-ups. Each octet depends on the result of the previous one.
+  kNibble,
+  // One table of 256 remainders, processing an octet per look-up. Each look-up depends on the
+  // result of the previous one.
+  kOctet,
+  // Eight (or sixteen) tables of 256 remainders each, processing eight (or sixteen) octets per
+  // iteration. The look-ups within an iteration are independent of one another, so they can be
+  // issued in parallel at the cost of 8x (or 16x) the table memory of |kOctet|.
+  kSliceBy8,
+  kSliceBy16,
+};
+
+// Selects when Crc generates its look-up tables (see CrcTablePolicy).
+enum class CrcTableInit {
+  // Tables are generated by the compiler and emitted into the binary as read-only data. They are
+  // also available in constant expressions.
+  kCompileTime,
+  // Tables are generated at run time into cache-line-aligned storage the first time that they are
+  // used, which is thread-safe. This keeps them out of the binary for programs that don't always
+  // compute CRCs. Checking that the tables were generated costs a little on each slice, or on each
+  // octet for unsliced policies. Constant expressions compute remainders bitwise instead.
+  kOnFirstUse,
+};
+
+// Order in which the octets of a multi-octet integer value are processed through a CRC by
+// |Crc::AppendValue|, with the same meanings as std::endian::little and std::endian::big.
+enum class CrcByteOrder {
+  // Least-significant octet first.
+  kLittleEndian,
+  // Most-significant octet first.
+  kBigEndian,
+};
+
+template <typename Type,
+          size_t PolynomialBitWidth,
+          Type Polynomial,
+          Type InitialValue,
+          bool Reflect,
+          Type OutputXorMask>
+class CrcTraits;
+
 // Computes a cyclic redundancy check (CRC) over a message using the CRC model parameters specified
 // by |Traits|. Some CRC models are provided as aliases of the |CrcTraits| helper class.
 //
@@ -115,15 +603,35 @@ template <typename T, size_t BitWidth>
 //   crc.AppendOctets("6789", 4);
 //   uint16_t check_value = crc.GetCheckValue();  // |check_value| is 0xbb3d
 //
+// The |TablePolicy| template parameter selects the look-up tables used for octet-aligned data
+// (see CrcTablePolicy), and |TableInit| selects whether they are generated at compile time or on
+// first use at run time (see CrcTableInit). The check values are the same regardless of policy.
+// On x86-64 CPUs that support the PCLMULQDQ instruction, long messages are instead folded using
+// carry-less multiplication at run time (this can be disabled by defining MAYS_CRC_DISABLE_CLMUL).
+// Likewise, CRC-32C models (e.g. Crc32Iscsi) use the SSE4.2 CRC32 instruction on CPUs that support
+// it (this can be disabled by defining MAYS_CRC_DISABLE_SSE42).
+//
+// Example:
+//   using FastCrc = Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>;
+//   uint32_t check_value = FastCrc::Compute(buffer.data(), buffer.size());
+//
+//   // Same, but without 8 KiB of tables in the binary.
+//   using LazyCrc = Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8, CrcTableInit::kOnFirstUse>;
+//
 // The model used is originally specified in "A Painless Guide to CRC Error Detection Algorithms"
 // (Ross N. Williams, 1993), accessed at https://zlib.net/crc_v3.txt and the implementation is also
 // written from first principles using the ideas therein, including documenting the implementation
 // simultaneously as a linear-feedback shift register (LFSR) and as mod-2 polynomial long division.
-template <typename Traits>
+template <typename Traits,
+          CrcTablePolicy TablePolicy = CrcTablePolicy::kOctet,
+          CrcTableInit TableInit = CrcTableInit::kCompileTime>
 class Crc {
  public:
   using RegisterType = typename Traits::RegisterType;
 
+  // Number of octets needed to store a check value, e.g. 4 for 32-bit models.
+  static constexpr size_t kCheckValueLength = (Traits::kPolynomialBitWidth + 7) / 8;
+
   // Construct a CRC computation whose state is initialized with |initial_value|, which is specified
   // higher-power-left and will be reflected as necessary for the CRC model.
   constexpr explicit Crc(RegisterType initial_value = Traits::kInitialValue)
@@ -140,6 +648,92 @@ class Crc {
     return crc.GetCheckValue();
   }
 
+  // Computes a CRC check value over an array of octets whose length is known at compile time. Short
+  // messages are processed a word at a time with the loop fully unrolled, which avoids the run-time
+  // dispatch and loop overhead of processing arbitrary lengths. Note that string literals include
+  // their null terminator.
+  //
+  // Example:
+  //   uint8_t payload[8] = {…};
+  //   uint16_t check_value = Crc<Crc15Can>::Compute(payload);
+  template <typename Octet, size_t Length>
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  [[nodiscard]] static constexpr RegisterType Compute(const Octet (&data)[Length]) {
+    Crc crc;
+    crc.AppendOctetsOfLength<Length>(data);
+    return crc.GetCheckValue();
+  }
+
+  // Computes a CRC check value over a span of octets with a static extent, e.g.
+  // std::span<const uint8_t, 20>. See the overload above taking an array.
+  template <typename StaticSpan>
+    // Static extents are anything other than std::dynamic_extent, which is the maximum size_t.
+    requires(StaticSpan::extent != ~size_t{})
+  [[nodiscard]] static constexpr RegisterType Compute(StaticSpan data) {
+    Crc crc;
+    crc.AppendOctetsOfLength<StaticSpan::extent>(data.data());
+    return crc.GetCheckValue();
+  }
+
+  // Computes the check value of a message that is the concatenation of messages A and B, given
+  // only the check value of each and the length of B in octets. This allows parts of a message to
+  // be checked independently (e.g. concurrently) and then combined. Takes O(log(|length_b|)) time.
+  //
+  // Example:
+  //   const auto check_value_a = Crc<Crc32IsoHdlc>::Compute("1234", 4);
+  //   const auto check_value_b = Crc<Crc32IsoHdlc>::Compute("56789", 5);
+  //   // |check_value| is 0xcbf43926, the same as Crc<Crc32IsoHdlc>::Compute("123456789", 9)
+  //   const auto check_value = Crc<Crc32IsoHdlc>::Combine(check_value_a, check_value_b, 5);
+  [[nodiscard]] static constexpr RegisterType Combine(RegisterType check_value_a,
+                                                      RegisterType check_value_b,
+                                                      size_t length_b) {
+    // Continuing the CRC from the remainder after A through B is the same as shifting A's
+    // remainder past |length_b| zero octets and adding the remainder of B starting from zero, as
+    // the remainder is linear. B's check value instead started from the initial remainder, so that
+    // is also shifted past B and subtracted out.
+    const auto remainder_a = static_cast<RegisterType>(check_value_a ^ Traits::kOutputXorMask);
+    const auto shifted_remainders = MultiplyModPolynomial(
+        static_cast<RegisterType>(remainder_a ^ OrientPolynomial(Traits::kInitialValue)),
+        GetOctetShiftFactor(length_b));
+    return static_cast<RegisterType>(shifted_remainders ^ check_value_b);
+  }
+
+  // Returns the check value of a message after |length| octets at |offset| are changed from
+  // |old_data| to |new_data|, given the message's |old_check_value| and |total_length| in octets.
+  // The rest of the message is not needed. |offset| + |length| must not exceed |total_length|.
+  // Takes O(|length| + log(|total_length|)) time.
+  //
+  // Example:
+  //   // Overwrite the 4-octet sequence number at offset 12 of |record|.
+  //   std::array<uint8_t, 4> old_sequence;
+  //   std::copy_n(&record[12], 4, old_sequence.begin());
+  //   std::copy_n(new_sequence.begin(), 4, &record[12]);
+  //   check_value = Crc<Crc32IsoHdlc>::Patch(check_value, 12, old_sequence.data(),
+  //                                          new_sequence.data(), 4, record.size());
+  template <typename Octet>
+  [[nodiscard]] static constexpr RegisterType Patch(RegisterType old_check_value,
+                                                    size_t offset,
+                                                    const Octet* old_data,
+                                                    const Octet* new_data,
+                                                    size_t length,
+                                                    size_t total_length) {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+
+    // The CRC is affine in the message, so the change in check value is the remainder of a message
+    // that is the sum of the old and new messages (i.e. zero outside of the changed octets),
+    // computed from a zero initial remainder and without the output XOR.
+    Crc difference(0);
+    for (size_t i = 0; i < length; i++) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      difference.AppendOctet(static_cast<uint8_t>(old_data[i] ^ new_data[i]));
+    }
+
+    // Shift past the unchanged octets after the changed ones, which are all zero in the sum.
+    const RegisterType shifted_difference = MultiplyModPolynomial(
+        difference.remainder_, GetOctetShiftFactor(total_length - offset - length));
+    return static_cast<RegisterType>(old_check_value ^ shifted_difference);
+  }
+
   // Processes a sequence of octets through the CRC. May be called multiple times to process parts
   // of a full sequence. Calls to this function do not commutate. The |Octet| template parameter
   // must be an 8-bit type, e.g. uint8_t, std::byte, char, etc.
@@ -148,21 +742,332 @@ class Crc {
     // Templated on |Octet| instead of taking |const void*| to allow constexpr computation.
     static_assert(sizeof(Octet) == sizeof(uint8_t));
 
-    // Each iteration shifts an octet into the long division feedback system (i.e. for 8 cycles).
+#if MAYS_CRC_HAS_SSE42
+    if constexpr (kIsCrc32c) {
+      if (!__builtin_is_constant_evaluated() && detail::CpuSupportsSse42()) {
+        AppendSse42(data, length);
+        return;
+      }
+    }
+#endif  // MAYS_CRC_HAS_SSE42
+
+#if MAYS_CRC_HAS_CLMUL
+    // Fold whole 16-octet blocks of long messages using carry-less multiplication, leaving the rest
+    // for the look-up tables.
+    if (!__builtin_is_constant_evaluated() && length >= kClmulMinLength &&
+        detail::CpuSupportsClmul()) {
+      const size_t fold_length = length - length % 16;
+      AppendClmulFold(data, fold_length);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data += fold_length;
+      length -= fold_length;
+    }
+#endif  // MAYS_CRC_HAS_CLMUL
+
+    if constexpr (kSliceCount > 1) {
+      for (; length >= kSliceCount; length -= kSliceCount) {
+        AppendSlice(data);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data += kSliceCount;
+      }
+    }
+
     for (size_t i = 0; i < length; i++) {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-      const auto data_byte = static_cast<uint8_t>(data[i]);
-      const auto [remainder_msbyte, remainder_lsbytes] = SplitRemainder();
+      AppendOctet(static_cast<uint8_t>(data[i]));
+    }
+  }
+
+  // Copies |length| octets from |source| to |destination| and processes them through the CRC, the
+  // same as memcpy(3) followed by |AppendOctets(destination, length)|. The octet ranges must not
+  // overlap.
+  //
+  // The copy is done in blocks small enough to stay in L1 cache, each of which is processed
+  // through the CRC right after being copied, so message data is only read from memory once
+  // instead of twice.
+  template <typename DestinationOctet, typename SourceOctet>
+  constexpr void CopyAndAppend(DestinationOctet* destination,
+                               const SourceOctet* source,
+                               size_t length) {
+    static_assert(sizeof(DestinationOctet) == sizeof(uint8_t));
+    static_assert(sizeof(SourceOctet) == sizeof(uint8_t));
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t offset = 0; offset < length; offset += kCopyBlockLength) {
+      const size_t block_length =
+          length - offset < kCopyBlockLength ? length - offset : kCopyBlockLength;
+      if (__builtin_is_constant_evaluated()) {
+        for (size_t i = 0; i < block_length; i++) {
+          destination[offset + i] = static_cast<DestinationOctet>(source[offset + i]);
+        }
+      } else {
+        __builtin_memcpy(destination + offset, source + offset, block_length);
+      }
+      AppendOctets(destination + offset, block_length);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  // Computes the check values of a batch of independent messages, equivalent to calling |Compute|
+  // on each. |messages| is a random-access range (e.g. std::span<const std::span<const uint8_t>>)
+  // of messages that each have |data()| and |size()|, and |check_values| is a random-access range
+  // (e.g. std::span<RegisterType>) for the results, in the same order.
+  //
+  // Several messages are processed in lockstep, so the look-ups for different messages can overlap
+  // in the CPU instead of waiting on the look-up for the previous octet of the same message. This
+  // is intended for large numbers of short messages. Messages long enough to use the
+  // carry-less multiplication or CRC instructions in |AppendOctets| are computed individually.
+  //
+  // Example:
+  //   std::vector<std::string_view> packets = …;
+  //   std::vector<uint32_t> check_values(packets.size());
+  //   Crc<Crc32IsoHdlc>::ComputeMany(packets, check_values);
+  template <typename Messages, typename CheckValues>
+  static constexpr void ComputeMany(const Messages& messages, CheckValues&& check_values) {
+    const size_t num_messages = messages.size();
+
+    // Messages that would be processed without look-up tables (see |AppendOctets|) gain nothing
+    // from being in a lane and are instead computed individually.
+    bool has_sse42 = false;
+    size_t min_folded_length = ~size_t{};
+    if (!__builtin_is_constant_evaluated()) {
+#if MAYS_CRC_HAS_SSE42
+      has_sse42 = kIsCrc32c && detail::CpuSupportsSse42();
+#endif  // MAYS_CRC_HAS_SSE42
+#if MAYS_CRC_HAS_CLMUL
+      min_folded_length = detail::CpuSupportsClmul() ? kClmulMinLength : min_folded_length;
+#endif  // MAYS_CRC_HAS_CLMUL
+    }
+    auto compute_individually = [&](size_t message_index) {
+      const auto& message = messages[message_index];
+      if (has_sse42 || num_messages < kManyLaneCount || message.size() >= min_folded_length) {
+        check_values[message_index] = Compute(message.data(), message.size());
+        return true;
+      }
+      return false;
+    };
+
+    // Each lane holds the state of one message in progress. Whenever a lane's message is complete,
+    // its check value is stored and the lane is refilled with the next message, so that all lanes
+    // stay busy until the batch runs out of messages.
+    using OctetPointer = decltype(messages[0].data());
+    // NOLINTBEGIN(modernize-avoid-c-arrays,cppcoreguidelines-pro-bounds-constant-array-index)
+    Crc crcs[kManyLaneCount];
+    OctetPointer data[kManyLaneCount] = {};
+    size_t lengths[kManyLaneCount] = {};
+    size_t message_indices[kManyLaneCount] = {};
+    size_t next_message_index = 0;
+
+    // Returns false if there are no messages left to start.
+    auto start_message = [&](size_t lane) {
+      for (; next_message_index < num_messages; next_message_index++) {
+        if (!compute_individually(next_message_index)) {
+          const auto& message = messages[next_message_index];
+          crcs[lane] = Crc();
+          data[lane] = message.data();
+          lengths[lane] = message.size();
+          message_indices[lane] = next_message_index++;
+          return true;
+        }
+      }
+      message_indices[lane] = num_messages;
+      return false;
+    };
+    bool lanes_full = true;
+    for (size_t lane = 0; lane < kManyLaneCount; lane++) {
+      lanes_full = start_message(lane) && lanes_full;
+    }
 
-      // Add the remainder to the next eight bits of message.
-      const uint8_t dividend = data_byte ^ remainder_msbyte;
+    while (lanes_full) {
+      // Advance each lane through the length remaining for all of them. Octets are loaded a word
+      // at a time, but each lane's octets are still processed serially.
+      size_t lockstep_length = lengths[0];
+      for (size_t lane = 1; lane < kManyLaneCount; lane++) {
+        lockstep_length = lengths[lane] < lockstep_length ? lengths[lane] : lockstep_length;
+      }
+      size_t offset = 0;
+      for (; offset + 8 <= lockstep_length; offset += 8) {
+#pragma GCC unroll 8
+        for (size_t lane = 0; lane < kManyLaneCount; lane++) {
+          if constexpr (kSliceCount == 8) {
+            crcs[lane].AppendSlice(&data[lane][offset]);
+          } else {
+            const uint64_t word = LoadWord(&data[lane][offset]);
+#pragma GCC unroll 8
+            for (size_t i = 0; i < 8; i++) {
+              crcs[lane].AppendOctet(
+                  static_cast<uint8_t>(Traits::kReflect ? word >> (8 * i) : word >> (56 - 8 * i)));
+            }
+          }
+        }
+      }
+      for (; offset < lockstep_length; offset++) {
+#pragma GCC unroll 8
+        for (size_t lane = 0; lane < kManyLaneCount; lane++) {
+          crcs[lane].AppendOctet(static_cast<uint8_t>(data[lane][offset]));
+        }
+      }
+
+      for (size_t lane = 0; lane < kManyLaneCount; lane++) {
+        data[lane] = &data[lane][lockstep_length];
+        lengths[lane] -= lockstep_length;
+        if (lengths[lane] == 0) {
+          check_values[message_indices[lane]] = crcs[lane].GetCheckValue();
+          lanes_full = start_message(lane) && lanes_full;
+        }
+      }
+    }
 
-      // |remainder_lsbytes| contains all the remainder bits that do not participate in the feedback
-      // with the 8 message bits, aside from being shifted 8 positions. The shift is associative
-      // w.r.t. addition, and was already performed by |SplitRemainder|, so add those bits back in
-      // after operating the feedback shift register.
-      remainder_ = kMemoizedRemainders.GetRemainderForOctet(dividend) ^ remainder_lsbytes;
+    // Out of messages to refill with, so finish the remaining ones individually.
+    for (size_t lane = 0; lane < kManyLaneCount; lane++) {
+      if (message_indices[lane] < num_messages) {
+        crcs[lane].AppendOctets(data[lane], lengths[lane]);
+        check_values[message_indices[lane]] = crcs[lane].GetCheckValue();
+      }
     }
+    // NOLINTEND(modernize-avoid-c-arrays,cppcoreguidelines-pro-bounds-constant-array-index)
+  }
+
+  // Verifies a batch of |num_records| contiguous records of |record_length| octets each, which end
+  // in the check value of the rest of the record. |passed_masks| is a random-access range (e.g.
+  // std::span<uint64_t>) of at least |(num_records + 63) / 64| masks, of which bit |i % 64| of
+  // mask |i / 64| is set if record i passed and cleared otherwise.
+  //
+  // The check value occupies the last |kCheckValueLength| octets of each record in the order that
+  // the model shifts bits in, i.e. little-endian for reflected models (|Traits::kReflect|) and
+  // big-endian for unreflected ones.
+  //
+  // On CPUs that support SSSE3, models up to 16 bits wide verify records 16 at a time, one record
+  // per byte lane of a vector register. All records have the same length, so the lanes advance in
+  // step: each octet offset of the records in a group is transposed into one vector, and the
+  // table look-up for all 16 lanes is done with byte shuffles of 16-entry tables of the remainders
+  // for each nibble of the dividend. Other models, and records left over from the last full group,
+  // are verified one at a time with |Compute|.
+  //
+  // Example:
+  //   // 256 telemetry frames of 16 octets, each with a big-endian CRC-16/XMODEM at the end.
+  //   uint64_t passed[4];
+  //   Crc<Crc16Xmodem>::VerifyRecords(frames, 16, 256, passed);
+  template <typename Octet, typename PassedMasks>
+  static constexpr void VerifyRecords(const Octet* records,
+                                      size_t record_length,
+                                      size_t num_records,
+                                      PassedMasks&& passed_masks) {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+    for (size_t i = 0; i < (num_records + 63) / 64; i++) {
+      passed_masks[i] = 0;
+    }
+    if (record_length < kCheckValueLength) {
+      return;
+    }
+    const size_t payload_length = record_length - kCheckValueLength;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto verify = [&](size_t record_index, RegisterType check_value) {
+      const Octet* const stored = records + record_index * record_length + payload_length;
+      RegisterType stored_check_value = 0;
+      for (size_t j = 0; j < kCheckValueLength; j++) {
+        const auto octet = static_cast<RegisterType>(static_cast<uint8_t>(stored[j]));
+        stored_check_value |= static_cast<RegisterType>(
+            octet << (8 * (Traits::kReflect ? j : kCheckValueLength - 1 - j)));
+      }
+      passed_masks[record_index / 64] |= uint64_t{stored_check_value == check_value}
+                                         << (record_index % 64);
+    };
+
+    size_t record_index = 0;
+#if MAYS_CRC_HAS_SSSE3
+    if constexpr (kPolynomialBitWidth <= 16) {
+      if (!__builtin_is_constant_evaluated() && detail::CpuSupportsSsse3()) {
+        constexpr size_t kLaneCount = 16;
+        const uint16_t initial_remainder = AlignForNibbleShuffles(Crc().remainder_);
+        for (; record_index + kLaneCount <= num_records; record_index += kLaneCount) {
+          // NOLINTBEGIN(modernize-avoid-c-arrays,cppcoreguidelines-pro-bounds-constant-array-index)
+          uint8_t leading[kLaneCount];
+          uint8_t trailing[kLaneCount];
+          for (size_t lane = 0; lane < kLaneCount; lane++) {
+            leading[lane] = GetLeadingByte(initial_remainder);
+            trailing[lane] = GetTrailingByte(initial_remainder);
+          }
+          detail::Ssse3NibbleRemainders<(kPolynomialBitWidth > 8)>(
+              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+              reinterpret_cast<const uint8_t*>(records + record_index * record_length),
+              record_length,
+              payload_length,
+              TableOwner::template kNibbleShuffles<>,
+              leading,
+              trailing);
+          for (size_t lane = 0; lane < kLaneCount; lane++) {
+            Crc crc;
+            crc.remainder_ = MergeNibbleShuffleBytes(leading[lane], trailing[lane]);
+            verify(record_index + lane, crc.GetCheckValue());
+          }
+          // NOLINTEND(modernize-avoid-c-arrays,cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+      }
+    }
+#endif  // MAYS_CRC_HAS_SSSE3
+
+    for (; record_index < num_records; record_index++) {
+      verify(record_index, Compute(records + record_index * record_length, payload_length));
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  // Processes a message made of a sequence of segments through the CRC, the same as calling
+  // |AppendOctets| on each segment in order. |segments| is a range (e.g. std::span) of segments
+  // that each have |data()| and |size()| (e.g. std::span<const uint8_t>, std::string_view) or
+  // POSIX |iov_base| and |iov_len| (struct iovec).
+  //
+  // Segments shorter than |kSegmentCarryLength| and the ends of longer segments are gathered into
+  // a buffer before processing, so that the wide look-up, folding, and CRC instruction paths of
+  // |AppendOctets| keep running across segment boundaries instead of falling back to processing an
+  // octet at a time at the end of each segment.
+  //
+  // Example:
+  //   iovec segments[] = {{header, header_length}, {payload, payload_length}};
+  //   Crc<Crc32Iscsi> crc;
+  //   crc.AppendSegments(segments);
+  template <typename Segments>
+  constexpr void AppendSegments(const Segments& segments) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays,cppcoreguidelines-pro-type-member-init)
+    uint8_t carry[kSegmentCarryLength];
+    size_t carry_length = 0;
+    auto append_segment = [&](const auto* data, size_t length) {
+      while (length > 0) {
+        if (carry_length > 0 || length < kSegmentCarryLength) {
+          const size_t carry_space = kSegmentCarryLength - carry_length;
+          const size_t copy_length = length < carry_space ? length : carry_space;
+          for (size_t i = 0; i < copy_length; i++) {
+            carry[carry_length + i] = static_cast<uint8_t>(data[i]);
+          }
+          carry_length += copy_length;
+          data += copy_length;
+          length -= copy_length;
+          if (carry_length == kSegmentCarryLength) {
+            AppendOctets(carry, carry_length);
+            carry_length = 0;
+          }
+        } else {
+          // Process the segment in place, leaving a ragged end to be carried into the next.
+          const size_t direct_length = length - length % kSegmentBlockLength;
+          AppendOctets(data, direct_length);
+          data += direct_length;
+          length -= direct_length;
+        }
+      }
+    };
+    for (const auto& segment : segments) {
+      if constexpr (requires { segment.iov_base; segment.iov_len; }) {
+        append_segment(static_cast<const uint8_t*>(segment.iov_base), segment.iov_len);
+      } else {
+        append_segment(segment.data(), segment.size());
+      }
+    }
+    AppendOctets(carry, carry_length);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
   }
 
   // Processes the rightmost |DataBitWidth| bits in |value| through the CRC. Other bits in |value|
@@ -173,17 +1078,16 @@ class Crc {
     static_assert(DataBitWidth <= sizeof(DataType) * 8,
                   "Can not process more bits than in type DataType");
 
-    // Use the memoized octet-oriented implementation to process 8 bits at a time.
-    if constexpr (DataBitWidth >= 8) {
+    // Use the memoized octet-oriented implementation for whole octets, one at a time for values
+    // wider than a word and all at once otherwise.
+    if constexpr (DataBitWidth > 64) {
       for (size_t num_data_bits = DataBitWidth; num_data_bits >= 8; num_data_bits -= 8) {
         const uint8_t octet = [&] {
           if constexpr (Traits::kReflect) {
             // Note that this branch is shifting |value| but the other does not. This leaves the
             // remaining |DataBitWidth % 8| bits at the rightmost positions of |value|.
             const auto octet = static_cast<uint8_t>(value);
-
-            // Shifting by 8 is done this way to allow for |DataType| = uint8_t.
-            value = (value >> 4) >> 4;
+            value >>= 8;
             return octet;
           } else {
             return static_cast<uint8_t>(value >> (num_data_bits - 8));
@@ -192,6 +1096,23 @@ class Crc {
         AppendOctets(&octet, 1);
       }
       AppendBits<DataBitWidth % 8>(static_cast<uint8_t>(value));
+    } else if constexpr (DataBitWidth >= 8) {
+      constexpr size_t kOctetCount = DataBitWidth / 8;
+      constexpr size_t kOctetBitWidth = 8 * kOctetCount;
+      if constexpr (Traits::kReflect) {
+        // Octets are shifted in starting from the rightmost, leaving the remaining
+        // |DataBitWidth % 8| bits to the left of them.
+        AppendWord<kOctetCount>(static_cast<uint64_t>(value));
+        if constexpr (DataBitWidth % 8 != 0) {
+          AppendBits<DataBitWidth % 8>(static_cast<uint8_t>(value >> kOctetBitWidth));
+        }
+      } else {
+        // Octets are shifted in starting from the leftmost, leaving the remaining
+        // |DataBitWidth % 8| bits at the rightmost positions of |value|.
+        const auto octets = static_cast<uint64_t>(value >> (DataBitWidth % 8));
+        AppendWord<kOctetCount>(octets << (64 - kOctetBitWidth));
+        AppendBits<DataBitWidth % 8>(static_cast<uint8_t>(value));
+      }
     } else if constexpr (DataBitWidth > 0) {
       // Mask off all but the rightmost |DataBitWidth| bits.
       constexpr auto kMask = detail::MaskLowBits<uint8_t, DataBitWidth>();
@@ -223,25 +1144,97 @@ class Crc {
     }
   }
 
+  // Processes the octets of the integer |value| through the CRC in |ByteOrder|, the same as
+  // |AppendOctets| on its object representation in that byte order. All octets are processed at
+  // once with the SSE4.2 CRC32 instruction for CRC-32C models or with the sliced look-up tables if
+  // |TablePolicy| has them, and one at a time otherwise.
+  //
+  // Example:
+  //   // Same as crc.AppendOctets("\x12\x34\x56\x78", 4).
+  //   crc.AppendValue<CrcByteOrder::kBigEndian>(uint32_t{0x12345678});
+  template <CrcByteOrder ByteOrder, typename ValueType>
+  constexpr void AppendValue(ValueType value) {
+    constexpr size_t kOctetCount = sizeof(ValueType);
+    static_assert(kOctetCount <= sizeof(uint64_t), "Can not process more than 64 bits at a time");
+    constexpr size_t kUnusedBitWidth = 64 - 8 * kOctetCount;
+
+    // Pack the octets in the order that |LoadWord| would have loaded them from memory.
+    const uint64_t bits = static_cast<uint64_t>(value) & (~uint64_t{} >> kUnusedBitWidth);
+    constexpr bool kFirstOctetIsLsbyte = ByteOrder == CrcByteOrder::kLittleEndian;
+    if constexpr (Traits::kReflect == kFirstOctetIsLsbyte) {
+      AppendWord<kOctetCount>(Traits::kReflect ? bits : bits << kUnusedBitWidth);
+    } else {
+      const uint64_t swapped_bits = __builtin_bswap64(bits);
+      AppendWord<kOctetCount>(Traits::kReflect ? swapped_bits >> kUnusedBitWidth : swapped_bits);
+    }
+  }
+
+  // Processes |bit_count| message bits through the CRC, starting |bit_offset| bits into |data|.
+  // Bits are numbered in the order the model shifts them in: from the LSb of each octet for
+  // reflected models (|Traits::kReflect|) and from the MSb for unreflected ones. This is equivalent
+  // to calling |AppendBits<1>| on each bit, but whole octets are processed with |AppendOctets| and
+  // the partial octets at either end with a single table look-up each.
+  //
+  // Example:
+  //   // Process an 83-bit CAN frame that starts three bits into |frame|.
+  //   Crc<Crc15Can> crc;
+  //   crc.AppendBitSpan(frame, 3, 83);
+  template <typename Octet>
+  constexpr void AppendBitSpan(const Octet* data, size_t bit_offset, size_t bit_count) {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data += bit_offset / 8;
+    const size_t head_bit_offset = bit_offset % 8;
+    if (head_bit_offset != 0 && bit_count > 0) {
+      const size_t head_bit_limit = 8 - head_bit_offset;
+      const size_t head_bit_count = bit_count < head_bit_limit ? bit_count : head_bit_limit;
+      const auto head = static_cast<uint8_t>(data[0]);
+      AppendPartialOctet(
+          static_cast<uint8_t>(Traits::kReflect ? head >> head_bit_offset
+                                                : head >> (8 - head_bit_offset - head_bit_count)),
+          head_bit_count);
+      data++;
+      bit_count -= head_bit_count;
+    }
+
+    const size_t length = bit_count / 8;
+    AppendOctets(data, length);
+
+    const size_t tail_bit_count = bit_count % 8;
+    if (tail_bit_count != 0) {
+      const auto tail = static_cast<uint8_t>(data[length]);
+      AppendPartialOctet(
+          static_cast<uint8_t>(Traits::kReflect ? tail : tail >> (8 - tail_bit_count)),
+          tail_bit_count);
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
   // Returns the current CRC check value.
   [[nodiscard]] constexpr RegisterType GetCheckValue() const {
     return remainder_ ^ Traits::kOutputXorMask;
   }
 
  private:
+  // Allows access to the tables of |TableOwner|.
+  template <typename, CrcTablePolicy, CrcTableInit>
+  friend class Crc;
+
   // Memoizes computing a remainder for each of the 256 possible 8-bit values at compile time.
   class OctetRemainderTable {
    public:
     constexpr OctetRemainderTable() {
-      for (size_t i = 0; i < sizeof(remainders_) / sizeof(RegisterType); i++) {
-        // |kReversePolynomial| is higher-power-right, so this unintuitively negative reflect
-        // condition is to orient the MSb (left) of unreflected data towards the right in order to
-        // account for "reflecting the world" (Williams).
-        const auto value =
-            static_cast<uint8_t>(Traits::kReflect ? i : detail::ReflectBits<size_t, 8>(i));
-
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
-        remainders_[i] = GetRemainderForBits(value);
+      // As the remainder is linear in the message bits, only the eight octets with a single bit set
+      // need to be divided. Every other octet's remainder is the sum of the remainders of its bits,
+      // which is built up from the remainders of the octets with lower bits already computed.
+      for (size_t bit = 1; bit < (1 << 8); bit <<= 1) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        const RegisterType bit_remainder =
+            GetRemainderForBits(OrientOctet(static_cast<uint8_t>(bit)));
+        for (size_t lower_bits = 0; lower_bits < bit; lower_bits++) {
+          remainders_[bit | lower_bits] = bit_remainder ^ remainders_[lower_bits];
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
       }
     }
 
@@ -257,13 +1250,370 @@ class Crc {
     RegisterType remainders_[1 << 8] = {};
   };
 
+  // Memoizes the remainders for each of the 16 possible values of the higher and lower nibbles of
+  // an octet. As the remainder is linear in the message bits, the remainder of an octet is the sum
+  // of the remainders of its two nibbles (each with the other nibble set to zero).
+  class NibbleRemainderTable {
+   public:
+    constexpr NibbleRemainderTable() {
+      // Built up from single-bit remainders the same way as |OctetRemainderTable|.
+      for (size_t bit = 1; bit < (1 << 4); bit <<= 1) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+        const RegisterType high_bit_remainder =
+            GetRemainderForBits(OrientOctet(static_cast<uint8_t>(bit << 4)));
+        const RegisterType low_bit_remainder =
+            GetRemainderForBits(OrientOctet(static_cast<uint8_t>(bit)));
+        for (size_t lower_bits = 0; lower_bits < bit; lower_bits++) {
+          high_remainders_[bit | lower_bits] = high_bit_remainder ^ high_remainders_[lower_bits];
+          low_remainders_[bit | lower_bits] = low_bit_remainder ^ low_remainders_[lower_bits];
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+    }
+
+    [[nodiscard]] constexpr RegisterType GetRemainderForOctet(uint8_t octet) const {
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+      return high_remainders_[octet >> 4] ^ low_remainders_[octet & 0xf];
+      // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+   private:
+    // NOLINTBEGIN(modernize-avoid-c-arrays)
+    RegisterType high_remainders_[1 << 4] = {};
+    RegisterType low_remainders_[1 << 4] = {};
+    // NOLINTEND(modernize-avoid-c-arrays)
+  };
+
+  // Extends |kMemoizedRemainders| with the remainders for each octet followed by 1 to
+  // |SliceCount - 1| zero octets, which is the contribution of an octet to the remainder of a slice
+  // of |SliceCount| octets based on its distance from the end of the slice.
+  template <size_t SliceCount>
+  class SlicedRemainderTable {
+   public:
+    constexpr SlicedRemainderTable() {
+      // Built up from single-bit remainders the same way as |OctetRemainderTable|, so that only
+      // those are shifted through zero octets. These are computed bitwise rather than with
+      // |kMemoizedRemainders| so that generating these tables at run time doesn't emit it too.
+      for (size_t bit = 1; bit < (1 << 8); bit <<= 1) {
+        RegisterType remainder = GetRemainderForBits(OrientOctet(static_cast<uint8_t>(bit)));
+        for (size_t num_zero_octets = 0; num_zero_octets < SliceCount; num_zero_octets++) {
+          for (size_t lower_bits = 0; lower_bits < bit; lower_bits++) {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+            remainders_[num_zero_octets][bit | lower_bits] =
+                remainder ^ remainders_[num_zero_octets][lower_bits];
+            // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+
+          remainder = ShiftZeroOctet(remainder);
+        }
+      }
+    }
+
+    [[nodiscard]] constexpr RegisterType GetRemainderForOctet(size_t num_zero_octets,
+                                                              uint8_t octet) const {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      return remainders_[num_zero_octets][octet];
+    }
+
+   private:
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    RegisterType remainders_[SliceCount][1 << 8] = {};
+  };
+
+  // Processes an octet through the CRC by shifting it into the long division feedback system (i.e.
+  // for 8 cycles).
+  constexpr void AppendOctet(uint8_t octet) {
+    const auto [remainder_msbyte, remainder_lsbytes] = SplitRemainder(remainder_);
+
+    // Add the remainder to the next eight bits of message.
+    const uint8_t dividend = octet ^ remainder_msbyte;
+
+    // |remainder_lsbytes| contains all the remainder bits that do not participate in the feedback
+    // with the 8 message bits, aside from being shifted 8 positions. The shift is associative
+    // w.r.t. addition, and was already performed by |SplitRemainder|, so add those bits back in
+    // after operating the feedback shift register.
+    remainder_ = GetRemainderForOctet(dividend) ^ remainder_lsbytes;
+  }
+
+  // Processes |Length| octets through the CRC. Short messages are processed as a fully unrolled
+  // sequence of |AppendWord| calls, which the compiler can schedule as one straight-line block.
+  template <size_t Length, typename Octet>
+  constexpr void AppendOctetsOfLength(const Octet* data) {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+#if MAYS_CRC_HAS_SSE42
+    // The SSE4.2 path can't be inlined into callers compiled without SSE4.2, so call it only once.
+    if constexpr (kIsCrc32c) {
+      if (!__builtin_is_constant_evaluated() && detail::CpuSupportsSse42()) {
+        AppendSse42(data, Length);
+        return;
+      }
+    }
+#endif  // MAYS_CRC_HAS_SSE42
+
+    if constexpr (Length > kMaxUnrolledLength) {
+      AppendOctets(data, Length);
+    } else {
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#pragma GCC unroll 8
+      for (size_t offset = 0; offset + 8 <= Length; offset += 8) {
+        AppendWord<8>(LoadWord(data + offset));
+      }
+      if constexpr (Length % 8 != 0) {
+        AppendWord<Length % 8>(LoadWord<Length % 8>(data + Length - Length % 8));
+      }
+      // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // Processes |kSliceCount| octets through the CRC. The entire remainder is added to the leading
+  // message octets up front (its width never exceeds that of a slice), after which every octet's
+  // contribution to the new remainder can be looked up independently of the others.
+  template <typename Octet>
+  constexpr void AppendSlice(const Octet* data) {
+    if (!CanUseSlicedTables()) {
+      for (size_t i = 0; i < kSliceCount; i++) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        AppendOctet(static_cast<uint8_t>(data[i]));
+      }
+      return;
+    }
+    const auto& sliced_remainders = GetSlicedRemainders();
+
+    // Remainder bits lined up with the message bits in the order that they're shifted in, which
+    // is the same order that |LoadWord| packs octets.
+    constexpr size_t kAlignShift = Traits::kReflect ? 0 : 64 - kPolynomialBitWidth;
+    uint64_t dividend_addend = uint64_t{remainder_} << kAlignShift;
+
+    // The loops are unrolled so that the look-ups are independent instructions that can be issued
+    // in parallel and the octet positions are constant-folded.
+    RegisterType remainder = 0;
+#pragma GCC unroll 2
+    for (size_t word_offset = 0; word_offset < kSliceCount; word_offset += 8) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const uint64_t dividend = LoadWord(data + word_offset) ^ dividend_addend;
+      dividend_addend = 0;
+#pragma GCC unroll 8
+      for (size_t i = 0; i < 8; i++) {
+        const size_t num_zero_octets = kSliceCount - 1 - (word_offset + i);
+        const auto octet =
+            static_cast<uint8_t>(Traits::kReflect ? dividend >> (8 * i) : dividend >> (56 - 8 * i));
+        remainder ^= sliced_remainders.GetRemainderForOctet(num_zero_octets, octet);
+      }
+    }
+    remainder_ = remainder;
+  }
+
+  // Processes the first |OctetCount| octets (at most eight) packed in |word| as by |LoadWord|
+  // through the CRC. Like |AppendSlice|, the look-ups are independent if |TablePolicy| has sliced
+  // tables, except that remainder bits past the message octets are shifted rather than looked up.
+  template <size_t OctetCount>
+  constexpr void AppendWord(uint64_t word) {
+    static_assert(OctetCount >= 1 && OctetCount <= 8);
+#if MAYS_CRC_HAS_SSE42
+    if constexpr (kIsCrc32c) {
+      if (!__builtin_is_constant_evaluated() && detail::CpuSupportsSse42()) {
+        remainder_ = detail::Sse42Crc32cWord<OctetCount>(remainder_, word);
+        return;
+      }
+    }
+#endif  // MAYS_CRC_HAS_SSE42
+
+    if constexpr (kSliceCount > 1) {
+      if (CanUseSlicedTables()) {
+        const auto& sliced_remainders = GetSlicedRemainders();
+        constexpr size_t kAlignShift = Traits::kReflect ? 0 : 64 - kPolynomialBitWidth;
+        const uint64_t dividend = word ^ (uint64_t{remainder_} << kAlignShift);
+        RegisterType remainder = 0;
+        if constexpr (kPolynomialBitWidth > 8 * OctetCount) {
+          remainder = Traits::kReflect
+                          ? static_cast<RegisterType>(remainder_ >> (8 * OctetCount))
+                          : static_cast<RegisterType>((remainder_ << (8 * OctetCount)) &
+                                                      kPolynomialMask);
+        }
+#pragma GCC unroll 8
+        for (size_t i = 0; i < OctetCount; i++) {
+          const auto octet = static_cast<uint8_t>(Traits::kReflect ? dividend >> (8 * i)
+                                                                   : dividend >> (56 - 8 * i));
+          remainder ^= sliced_remainders.GetRemainderForOctet(OctetCount - 1 - i, octet);
+        }
+        remainder_ = remainder;
+        return;
+      }
+    }
+
+#pragma GCC unroll 8
+    for (size_t i = 0; i < OctetCount; i++) {
+      AppendOctet(static_cast<uint8_t>(Traits::kReflect ? word >> (8 * i) : word >> (56 - 8 * i)));
+    }
+  }
+
+#if MAYS_CRC_HAS_CLMUL
+  // Processes |length| octets using carry-less multiplication. See |detail::ClmulFold|.
+  template <typename Octet>
+  void AppendClmulFold(const Octet* data, size_t length) {
+    // The folding is performed in the "reflected world," so unreflected CRCs reflect their message
+    // octets and remainder into it and back.
+    constexpr auto reflect_remainder = [](auto remainder) {
+      if constexpr (Traits::kReflect) {
+        return static_cast<RegisterType>(remainder);
+      } else {
+        return detail::ReflectBits<RegisterType, kPolynomialBitWidth>(
+            static_cast<RegisterType>(remainder));
+      }
+    };
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* octets = reinterpret_cast<const uint8_t*>(data);
+    remainder_ = reflect_remainder(detail::ClmulFold<!Traits::kReflect>(
+        reflect_remainder(remainder_), octets, length, kClmulFoldConstants));
+  }
+#endif  // MAYS_CRC_HAS_CLMUL
+
+#if MAYS_CRC_HAS_SSE42
+  // Processes |length| octets using the SSE4.2 CRC32 instruction. Only valid if |kIsCrc32c|.
+  template <typename Octet>
+  void AppendSse42(const Octet* data, size_t length) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* octets = reinterpret_cast<const uint8_t*>(data);
+    RegisterType remainder = remainder_;
+    for (; length >= 3 * kSse42BlockLength; length -= 3 * kSse42BlockLength) {
+      const auto [first, second, third] =
+          detail::Sse42Crc32cInterleaved(remainder, octets, kSse42BlockLength);
+
+      // Each block's remainder is shifted past the zeros that stand in for the blocks after it.
+      remainder = MultiplyModPolynomial(first, kSse42TwoBlockShiftFactor) ^
+                  MultiplyModPolynomial(second, kSse42BlockShiftFactor) ^ third;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      octets += 3 * kSse42BlockLength;
+    }
+    remainder_ = detail::Sse42Crc32c(remainder, octets, length);
+  }
+#endif  // MAYS_CRC_HAS_SSE42
+
+  // Packs eight octets into a word such that message bits are in the same order as the bits of an
+  // aligned remainder: first octet in the LSbyte for reflected CRCs and in the MSbyte otherwise.
+  // Compilers recognize this pattern as a single (possibly byte-swapping) load. If |OctetCount| is
+  // less than eight, only the first |OctetCount| octets of the word are loaded and the rest are 0.
+  template <size_t OctetCount = 8, typename Octet>
+  [[nodiscard]] static constexpr uint64_t LoadWord(const Octet* data) {
+    static_assert(OctetCount >= 1 && OctetCount <= 8);
+    uint64_t word = 0;
+#pragma GCC unroll 8
+    for (size_t i = 0; i < OctetCount; i++) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto octet = uint64_t{static_cast<uint8_t>(data[i])};
+      word |= Traits::kReflect ? octet << (8 * i) : octet << (56 - 8 * i);
+    }
+    return word;
+  }
+
+  // Processes the rightmost |bit_count| bits of |value| through the CRC, the same as
+  // |AppendBits<bit_count>(value)|, for |bit_count| in [1, 7]. The octet tables apply to fewer than
+  // eight bits because message bits of zero shifted in before any remainder bits are nonzero do not
+  // cause feedback: the remainder of the |bit_count| bits is the remainder of an octet made of
+  // those bits preceded by zeros.
+  constexpr void AppendPartialOctet(uint8_t value, size_t bit_count) {
+    const auto bits = static_cast<uint8_t>(value & ((1U << bit_count) - 1));
+    if constexpr (Traits::kReflect) {
+      // The octet's LSb is shifted in first, so the zeros precede |bits| on the right.
+      const auto dividend = static_cast<uint8_t>((bits ^ remainder_) << (8 - bit_count));
+      remainder_ = static_cast<RegisterType>(GetRemainderForOctet(dividend) ^
+                                             (remainder_ >> bit_count));
+    } else if (bit_count <= kPolynomialBitWidth) {
+      // Line up the next |bit_count| remainder bits at the left with the message bits.
+      const auto dividend =
+          static_cast<uint8_t>(bits ^ (remainder_ >> (kPolynomialBitWidth - bit_count)));
+      remainder_ = static_cast<RegisterType>(
+          GetRemainderForOctet(dividend) ^ ((remainder_ << bit_count) & kPolynomialMask));
+    } else {
+      const auto dividend =
+          static_cast<uint8_t>(bits ^ (remainder_ << (bit_count - kPolynomialBitWidth)));
+      remainder_ = GetRemainderForOctet(dividend);
+    }
+  }
+
+  // Orients an octet of message data (added to the remainder's highest-power bits) for
+  // |GetRemainderForBits|. |kReversePolynomial| is higher-power-right, so this unintuitively
+  // negative reflect condition is to orient the MSb (left) of unreflected data towards the right in
+  // order to account for "reflecting the world" (Williams).
+  [[nodiscard]] static constexpr uint8_t OrientOctet(uint8_t octet) {
+    return Traits::kReflect ? octet : detail::ReflectBits<uint8_t, 8>(octet);
+  }
+
+  // Returns the remainder for an octet of message data (added to the remainder's highest-power
+  // bits) using the method selected by |TablePolicy|.
+  [[nodiscard]] static constexpr RegisterType GetRemainderForOctet(uint8_t octet) {
+    if constexpr (TablePolicy == CrcTablePolicy::kBitwise) {
+      return GetRemainderForBits(OrientOctet(octet));
+    } else if constexpr (TableInit == CrcTableInit::kOnFirstUse) {
+      if (__builtin_is_constant_evaluated()) {
+        return GetRemainderForBits(OrientOctet(octet));
+      }
+      if constexpr (TablePolicy == CrcTablePolicy::kNibble) {
+        using Table = typename TableOwner::NibbleRemainderTable;
+        return TableOwner::template GetTableOnFirstUse<Table>().GetRemainderForOctet(octet);
+      } else {
+        using Table = typename TableOwner::OctetRemainderTable;
+        return TableOwner::template GetTableOnFirstUse<Table>().GetRemainderForOctet(octet);
+      }
+    } else if constexpr (TablePolicy == CrcTablePolicy::kNibble) {
+      return TableOwner::template kMemoizedNibbleRemainders<>.GetRemainderForOctet(octet);
+    } else {
+      return TableOwner::kMemoizedRemainders.GetRemainderForOctet(octet);
+    }
+  }
+
+  // Returns the sliced look-up tables for |kSliceCount|. Tables generated on first use are not
+  // available in constant expressions, in which case |CanUseSlicedTables| is false.
+  [[nodiscard]] static constexpr const auto& GetSlicedRemainders() {
+    if constexpr (TableInit == CrcTableInit::kOnFirstUse) {
+      using Table = typename TableOwner::template SlicedRemainderTable<kSliceCount>;
+      return TableOwner::template GetTableOnFirstUse<Table>();
+    } else {
+      return TableOwner::template kSlicedRemainders<kSliceCount>;
+    }
+  }
+
+  // True if the sliced look-up tables can be used in the current evaluation context.
+  [[nodiscard]] static constexpr bool CanUseSlicedTables() {
+    if constexpr (kSliceCount == 1) {
+      return false;
+    } else if constexpr (TableInit == CrcTableInit::kOnFirstUse) {
+      return !__builtin_is_constant_evaluated();
+    } else {
+      return true;
+    }
+  }
+
+  // Returns |remainder| after shifting in a zero octet, which only feeds back its highest-power
+  // bits. Computed bitwise, for generating tables.
+  [[nodiscard]] static constexpr RegisterType ShiftZeroOctet(RegisterType remainder) {
+    const auto [remainder_msbyte, remainder_lsbytes] = SplitRemainder(remainder);
+    return GetRemainderForBits(OrientOctet(remainder_msbyte)) ^ remainder_lsbytes;
+  }
+
+  // Returns a look-up table of type |Table|, generating it the first time this is called. Only used
+  // through |TableOwner| for |CrcTableInit::kOnFirstUse|, so that each table is generated once per
+  // polynomial and orientation. Initialization of function-local statics is thread-safe.
+  template <typename Table>
+  [[nodiscard]] static const Table& GetTableOnFirstUse() {
+    // Aligned to cache lines so that each table spans as few lines as possible.
+    alignas(64) static const Table table = GenerateTable<Table>();
+    return table;
+  }
+
+  // Not constexpr, so that the table in |GetTableOnFirstUse| isn't constant-initialized.
+  template <typename Table>
+  [[nodiscard]] static Table GenerateTable() {
+    return Table();
+  }
+
   // Returns a struct containing:
-  // - Highest-power bits (up to 8) of |remainder_|. In the case that |remainder_| has fewer than 8
+  // - Highest-power bits (up to 8) of |remainder|. In the case that |remainder| has fewer than 8
   //   bits: right-aligned if |Traits::kReflected|, else left-aligned.
   // - Any other bits of |remainder|. Occupies the rightmost bits in |RegisterType| but these bits
   //   are left-aligned if |Traits::kReflected| is false,
   //   e.g. for CRC-15 unreflected: 0b0xxx'xxxx'0000'0000
-  [[nodiscard]] constexpr auto SplitRemainder() const {
+  [[nodiscard]] static constexpr auto SplitRemainder(RegisterType remainder) {
     // Return type (needs to be decomposed with bindings)
     struct RemainderParts {
       uint8_t ms_byte;
@@ -275,24 +1625,78 @@ class Crc {
     // the feedback. So |ls_bytes| is zero in this case.
     if constexpr (kPolynomialBitWidth <= 8) {
       if constexpr (Traits::kReflect) {
-        return RemainderParts{static_cast<uint8_t>(remainder_), 0};
+        return RemainderParts{static_cast<uint8_t>(remainder), 0};
       } else {
         // First bit of message data to shift in is its MSb, so line up the remainder to the left.
-        return RemainderParts{static_cast<uint8_t>(remainder_ << (8 - kPolynomialBitWidth)), 0};
+        return RemainderParts{static_cast<uint8_t>(remainder << (8 - kPolynomialBitWidth)), 0};
       }
     } else {
       if constexpr (Traits::kReflect) {
-        return RemainderParts{static_cast<uint8_t>(remainder_),
-                              static_cast<RegisterType>(remainder_ >> 8)};
+        return RemainderParts{static_cast<uint8_t>(remainder),
+                              static_cast<RegisterType>(remainder >> 8)};
       } else {
         // First bit of message data needs to be added to the next bit of remainder, which is at its
         // leftmost position. Shift the remainder right to line it up with the message octet.
-        return RemainderParts{static_cast<uint8_t>(remainder_ >> (kPolynomialBitWidth - 8)),
-                              static_cast<RegisterType>((remainder_ << 8) & kPolynomialMask)};
+        return RemainderParts{static_cast<uint8_t>(remainder >> (kPolynomialBitWidth - 8)),
+                              static_cast<RegisterType>((remainder << 8) & kPolynomialMask)};
       }
     }
   }
 
+  // Converts between polynomials written higher-power-left and the orientation of |remainder_|.
+  [[nodiscard]] static constexpr RegisterType OrientPolynomial(RegisterType value) {
+    if constexpr (Traits::kReflect) {
+      return detail::ReflectBits<RegisterType, kPolynomialBitWidth>(value);
+    } else {
+      return value;
+    }
+  }
+
+  // Multiplies |value|, written higher-power-left, by x modulo the generator polynomial.
+  [[nodiscard]] static constexpr RegisterType MultiplyByX(RegisterType value) {
+    const bool subtract = ((value >> (kPolynomialBitWidth - 1)) & 0b1) != 0;
+    value = static_cast<RegisterType>((value << 1) & kPolynomialMask);
+    return subtract ? static_cast<RegisterType>(value ^ Traits::kPolynomial) : value;
+  }
+
+  // Multiplies the polynomials |a| and |b| modulo the generator polynomial, with all polynomials in
+  // the orientation of |remainder_|. This is used to shift a remainder past a run of zero message
+  // bits without processing each of them, as the remainder is linear in its message bits.
+  [[nodiscard]] static constexpr RegisterType MultiplyModPolynomial(RegisterType a,
+                                                                    RegisterType b) {
+    a = OrientPolynomial(a);
+    b = OrientPolynomial(b);
+
+    // Horner's method, starting from the highest-power coefficient of |a|.
+    RegisterType product = 0;
+    for (size_t i = kPolynomialBitWidth; i-- > 0;) {
+      product = MultiplyByX(product);
+      if (((a >> i) & 0b1) != 0) {
+        product ^= b;
+      }
+    }
+    return OrientPolynomial(product);
+  }
+
+  // Returns x**(8 * |num_octets|) modulo the generator polynomial, in the orientation of
+  // |remainder_|. Multiplying a remainder by this factor shifts it past |num_octets| zero octets.
+  [[nodiscard]] static constexpr RegisterType GetOctetShiftFactor(size_t num_octets) {
+    RegisterType x_to_8 = 1;
+    for (size_t i = 0; i < 8; i++) {
+      x_to_8 = MultiplyByX(x_to_8);
+    }
+
+    // Exponentiation by squaring.
+    RegisterType factor = OrientPolynomial(1);
+    for (RegisterType power = OrientPolynomial(x_to_8); num_octets != 0; num_octets >>= 1) {
+      if ((num_octets & 0b1) != 0) {
+        factor = MultiplyModPolynomial(factor, power);
+      }
+      power = MultiplyModPolynomial(power, power);
+    }
+    return factor;
+  }
+
   // Compute the remainder of |value| divided by |Traits::kPolynomial| in which each bit is a
   // coefficient of a |DataBitWidth|-th power polynomial, right-aligned within |DataType| with the
   // first coefficient to be shifted out in the ones (rightmost) position. Converting the data to
@@ -361,12 +1765,159 @@ class Crc {
   static constexpr RegisterType kPolynomialMask =
       detail::MaskLowBits<RegisterType, kPolynomialBitWidth>();
 
-  // Look-up table for remainders produced by each of the 256 possible octets. This is created for
-  // each instantiation of the Crc class (i.e. one table per model).
+  // Crc instantiation whose look-up tables are used by this one. Tables depend only on the register
+  // type, polynomial, and orientation, so models that differ only in initial value, output XOR
+  // mask, or table policy share the tables of one canonical instantiation.
+  using TableOwner = Crc<CrcTraits<RegisterType,
+                                   kPolynomialBitWidth,
+                                   Traits::kPolynomial,
+                                   RegisterType{},
+                                   Traits::kReflect,
+                                   RegisterType{}>>;
+
+  // Look-up table for remainders produced by each of the 256 possible octets. Only used through
+  // |TableOwner| (i.e. one table per polynomial and orientation).
   // Brace initialization is for GCC, which as of 11.2 uses C++14 rules for constexpr static members
   // in C++17 mode.
   static constexpr OctetRemainderTable kMemoizedRemainders{};
 
+  // Look-up tables for remainders produced by each nibble of an octet. Only instantiated for the
+  // |CrcTablePolicy::kNibble| policy (the template parameter is a dummy to defer instantiation).
+  template <typename = void>
+  static constexpr NibbleRemainderTable kMemoizedNibbleRemainders{};
+
+  // Number of octets processed per iteration of the sliced look-up tables (1 if unsliced).
+  static constexpr size_t kSliceCount = [] {
+    switch (TablePolicy) {
+      case CrcTablePolicy::kSliceBy8:
+        return size_t{8};
+      case CrcTablePolicy::kSliceBy16:
+        return size_t{16};
+      default:
+        return size_t{1};
+    }
+  }();
+
+#if MAYS_CRC_HAS_CLMUL
+  // Shortest message to fold using carry-less multiplication, below which the fixed cost of the
+  // final reduction outweighs the speedup over look-up tables.
+  static constexpr size_t kClmulMinLength = 128;
+
+  static constexpr detail::ClmulFoldConstants kClmulFoldConstants =
+      detail::MakeClmulFoldConstants<kPolynomialBitWidth>(Traits::kPolynomial);
+#endif  // MAYS_CRC_HAS_CLMUL
+
+  // True if the model uses the CRC-32C (Castagnoli) polynomial in the reflected orientation that
+  // the SSE4.2 CRC32 instruction computes. Initial value and output XOR mask can be arbitrary.
+  static constexpr bool kIsCrc32c = sizeof(RegisterType) == sizeof(uint32_t) &&
+                                    kPolynomialBitWidth == 32 &&
+                                    // NOLINTNEXTLINE(readability-magic-numbers)
+                                    Traits::kPolynomial == 0x1edc6f41 && Traits::kReflect;
+
+#if MAYS_CRC_HAS_SSE42
+  // Octets per block when interleaving three streams of CRC32 instructions. Long enough that the
+  // cost of combining the streams' remainders is insignificant.
+  static constexpr size_t kSse42BlockLength = 4096;
+
+  static constexpr RegisterType kSse42BlockShiftFactor =
+      kIsCrc32c ? GetOctetShiftFactor(kSse42BlockLength) : 0;
+  static constexpr RegisterType kSse42TwoBlockShiftFactor =
+      kIsCrc32c ? GetOctetShiftFactor(2 * kSse42BlockLength) : 0;
+#endif  // MAYS_CRC_HAS_SSE42
+
+  // Octets copied per block by |CopyAndAppend|. Small enough to stay in L1 cache between being
+  // copied and being read again for the CRC, but long enough to amortize the fixed cost of each
+  // call to |AppendOctets| (e.g. the final reduction after folding).
+  static constexpr size_t kCopyBlockLength = size_t{12} << 10;
+
+  // Octets that |AppendSegments| gathers from short segments before processing them together. Long
+  // enough for folding with carry-less multiplication (see |kClmulMinLength|).
+  static constexpr size_t kSegmentCarryLength = 256;
+
+  // Segments are processed in place in multiples of this many octets, which is a multiple of the
+  // octets processed per iteration by each of the paths in |AppendOctets|.
+  static constexpr size_t kSegmentBlockLength = 64;
+
+  // Longest message whose length is known at compile time that |AppendOctetsOfLength| unrolls.
+  // Longer messages are long enough to amortize the overhead of |AppendOctets|, and to benefit from
+  // its wide paths.
+  static constexpr size_t kMaxUnrolledLength = 64;
+
+#if MAYS_CRC_HAS_SSSE3
+  // Bit width of the remainders processed by |detail::Ssse3NibbleRemainders|, as one byte plane
+  // for models up to 8 bits wide and two otherwise. Only used for models up to 16 bits wide.
+  static constexpr size_t kNibbleShuffleBitWidth = kPolynomialBitWidth <= 8 ? 8 : 16;
+
+  // Aligns the leading bit of |remainder| to the leading bit of |kNibbleShuffleBitWidth| bits.
+  [[nodiscard]] static constexpr uint16_t AlignForNibbleShuffles(RegisterType remainder) {
+    if constexpr (Traits::kReflect) {
+      return static_cast<uint16_t>(remainder);
+    } else {
+      return static_cast<uint16_t>(remainder << (kNibbleShuffleBitWidth - kPolynomialBitWidth));
+    }
+  }
+
+  // Returns the byte of an aligned remainder that is added to the next octet of message data.
+  [[nodiscard]] static constexpr uint8_t GetLeadingByte(uint16_t aligned_remainder) {
+    return static_cast<uint8_t>(
+        Traits::kReflect ? aligned_remainder : aligned_remainder >> (kNibbleShuffleBitWidth - 8));
+  }
+
+  // Returns the other byte of an aligned remainder, if any.
+  [[nodiscard]] static constexpr uint8_t GetTrailingByte(uint16_t aligned_remainder) {
+    if constexpr (kNibbleShuffleBitWidth == 8) {
+      return 0;
+    } else {
+      return static_cast<uint8_t>(Traits::kReflect ? aligned_remainder >> 8 : aligned_remainder);
+    }
+  }
+
+  // Inverse of |AlignForNibbleShuffles| followed by splitting into leading and trailing bytes.
+  [[nodiscard]] static constexpr RegisterType MergeNibbleShuffleBytes(uint8_t leading,
+                                                                      uint8_t trailing) {
+    const auto aligned_remainder = static_cast<uint16_t>(
+        Traits::kReflect ? leading | (trailing << 8)
+                         : (leading << (kNibbleShuffleBitWidth - 8)) | trailing);
+    if constexpr (Traits::kReflect) {
+      return static_cast<RegisterType>(aligned_remainder);
+    } else {
+      return static_cast<RegisterType>(aligned_remainder >>
+                                       (kNibbleShuffleBitWidth - kPolynomialBitWidth));
+    }
+  }
+
+  [[nodiscard]] static constexpr detail::CrcNibbleShuffles MakeNibbleShuffles() {
+    detail::CrcNibbleShuffles shuffles{};
+    for (size_t nibble = 0; nibble < 16; nibble++) {
+      const auto high_octet = static_cast<uint8_t>(nibble << 4);
+      const auto low_octet = static_cast<uint8_t>(nibble);
+      const uint16_t high = AlignForNibbleShuffles(GetRemainderForBits(OrientOctet(high_octet)));
+      const uint16_t low = AlignForNibbleShuffles(GetRemainderForBits(OrientOctet(low_octet)));
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+      shuffles.leading_high[nibble] = GetLeadingByte(high);
+      shuffles.leading_low[nibble] = GetLeadingByte(low);
+      shuffles.trailing_high[nibble] = GetTrailingByte(high);
+      shuffles.trailing_low[nibble] = GetTrailingByte(low);
+      // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+    return shuffles;
+  }
+
+  // Byte shuffles for |VerifyRecords|. Only used through |TableOwner|, and only instantiated for
+  // models up to 16 bits wide (the template parameter is a dummy to defer instantiation).
+  template <typename = void>
+  static constexpr detail::CrcNibbleShuffles kNibbleShuffles = MakeNibbleShuffles();
+#endif  // MAYS_CRC_HAS_SSSE3
+
+  // Number of messages processed in lockstep by |ComputeMany|. Enough independent look-up chains
+  // to cover the latency of a load from L1 cache with the throughput of typical load ports.
+  static constexpr size_t kManyLaneCount = 8;
+
+  // Look-up tables for octets at each position within a slice. Only instantiated for sliced
+  // policies.
+  template <size_t SliceCount>
+  static constexpr SlicedRemainderTable<SliceCount> kSlicedRemainders{};
+
   // The remainder result of the long division is stored right-aligned with its most powerful
   // coefficient in the leftmost position for unreflected CRCs and rightmost (one's) position for
   // reflected CRCs, i.e. in the same orientation as final check value.
@@ -432,6 +1983,7 @@ using Crc24Ble = CrcTraits<uint32_t, 24, 0x00065b, 0x555555, true, 0>;
 using Crc24Openpgp = CrcTraits<uint32_t, 24, 0x864cfb, 0xb704ce, false, 0>;
 using Crc32Bzip2 = CrcTraits<uint32_t, 32, 0x04c11db7, 0xffffffff, false, 0xffffffff>;
 using Crc32IsoHdlc = CrcTraits<uint32_t, 32, 0x04c11db7, 0xffffffff, true, 0xffffffff>;
+using Crc32Iscsi = CrcTraits<uint32_t, 32, 0x1edc6f41, 0xffffffff, true, 0xffffffff>;
 using Crc64Ecma182 = CrcTraits<uint64_t, 64, 0x42f0e1eba9ea3693, 0, false, 0>;
 using Crc64Xz = CrcTraits<uint64_t, 64, 0x42f0e1eba9ea3693, ~uint64_t{0}, true, ~uint64_t{0}>;
 // NOLINTEND(readability-magic-numbers)
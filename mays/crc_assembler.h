@@ -0,0 +1,158 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_ASSEMBLER_H
+#define MAYS_CRC_ASSEMBLER_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+
+#include "crc.h"
+#include "internal/check.h"
+
+namespace mays {
+
+// Outcome of adding a chunk to a |CrcAssembler|.
+enum class CrcAssemblerStatus {
+  // The chunk was added, and the message is still incomplete.
+  kAdded,
+  // The chunk was added and completed the message.
+  kCompleted,
+  // Every octet of the chunk was already covered by chunks added before, e.g. because it was sent
+  // again. The chunk was ignored.
+  kDuplicate,
+  // The chunk overlaps chunks added before without being covered by them. The chunk was ignored.
+  kOverlap,
+};
+
+// Result of adding a chunk to a |CrcAssembler|.
+template <typename RegisterType>
+struct CrcAssemblerResult {
+  CrcAssemblerStatus status;
+  // Check value of the whole message if |status| is |CrcAssemblerStatus::kCompleted|.
+  std::optional<RegisterType> check_value;
+};
+
+// Assembles the check value of a message of |total_length| octets from the check values of its
+// chunks, which may arrive in any order and from any thread. Adjacent chunks are merged with
+// Crc<Traits>::Combine as soon as both have arrived, so at most one check value is kept per
+// contiguous range of chunks received so far and no second pass over the message is needed.
+//
+// Example:
+//   CrcAssembler<Crc32Iscsi> assembler(object_size);
+//   // On each downloader thread, after receiving a chunk:
+//   const auto chunk_check_value = Crc<Crc32Iscsi>::Compute(chunk.data(), chunk.size());
+//   const auto result = assembler.Add(chunk_offset, chunk_check_value, chunk.size());
+//   if (result.status == CrcAssemblerStatus::kCompleted) {
+//     // This was the last chunk, and |*result.check_value| is the check value of the whole object.
+//   }
+template <typename Traits>
+class CrcAssembler {
+ public:
+  using RegisterType = typename Crc<Traits>::RegisterType;
+
+  explicit CrcAssembler(size_t total_length) : total_length_(total_length) {}
+
+  // Adds the check value (as computed by Crc<Traits>::Compute) of |length| octets of the message
+  // starting at |offset|, which must not extend past the end of the message. The check value of the
+  // whole message is returned to the one call that completes it.
+  //
+  // Chunks whose octets were all covered by earlier chunks (including empty chunks) are ignored as
+  // duplicates, so that chunks may be delivered more than once. Their check values are not compared, because only the
+  // check values of merged ranges are kept. Chunks that partially overlap earlier chunks are
+  // ignored and reported, as they cannot be merged.
+  CrcAssemblerResult<RegisterType> Add(size_t offset, RegisterType check_value, size_t length) {
+    MAYS_CHECK(offset <= total_length_ && length <= total_length_ - offset);
+    const std::lock_guard lock(mutex_);
+    // An empty chunk has no octets that aren't already covered.
+    if (length == 0) {
+      return {CrcAssemblerStatus::kDuplicate, std::nullopt};
+    }
+
+    const size_t end = offset + length;
+    auto next = ranges_.upper_bound(offset);
+    if (next != ranges_.begin()) {
+      const auto previous = std::prev(next);
+      const size_t previous_end = previous->first + previous->second.length;
+      if (previous_end >= end) {
+        return {CrcAssemblerStatus::kDuplicate, std::nullopt};
+      }
+      if (previous_end > offset) {
+        return {CrcAssemblerStatus::kOverlap, std::nullopt};
+      }
+    }
+    if (next != ranges_.end() && next->first < end) {
+      return {CrcAssemblerStatus::kOverlap, std::nullopt};
+    }
+    auto range = ranges_.emplace_hint(next, offset, Range{length, check_value});
+
+    // Merge with the preceding range if it ends where this one starts.
+    if (range != ranges_.begin()) {
+      const auto previous = std::prev(range);
+      if (previous->first + previous->second.length == offset) {
+        previous->second.check_value =
+            Crc<Traits>::Combine(previous->second.check_value, check_value, length);
+        previous->second.length += length;
+        ranges_.erase(range);
+        range = previous;
+      }
+    }
+
+    // Merge with the following range if it starts where this one ends.
+    if (next != ranges_.end() && next->first == end) {
+      range->second.check_value = Crc<Traits>::Combine(
+          range->second.check_value, next->second.check_value, next->second.length);
+      range->second.length += next->second.length;
+      ranges_.erase(next);
+    }
+
+    if (range->second.length == total_length_) {
+      return {CrcAssemblerStatus::kCompleted, range->second.check_value};
+    }
+    return {CrcAssemblerStatus::kAdded, std::nullopt};
+  }
+
+  // Returns the check value of the whole message if all of its chunks have been added, or
+  // std::nullopt.
+  [[nodiscard]] std::optional<RegisterType> GetCheckValue() const {
+    if (total_length_ == 0) {
+      return Crc<Traits>::Compute(static_cast<const uint8_t*>(nullptr), 0);
+    }
+    const std::lock_guard lock(mutex_);
+    if (ranges_.size() == 1 && ranges_.begin()->second.length == total_length_) {
+      return ranges_.begin()->second.check_value;
+    }
+    return std::nullopt;
+  }
+
+  // Returns the number of octets of the message covered by the chunks added so far.
+  [[nodiscard]] size_t GetCoveredLength() const {
+    const std::lock_guard lock(mutex_);
+    size_t covered_length = 0;
+    for (const auto& entry : ranges_) {
+      covered_length += entry.second.length;
+    }
+    return covered_length;
+  }
+
+ private:
+  // Contiguous range of chunks that have been added, keyed by offset in |ranges_|.
+  struct Range {
+    size_t length;
+    RegisterType check_value;
+  };
+
+  const size_t total_length_;
+  mutable std::mutex mutex_;
+  std::map<size_t, Range> ranges_;
+};
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_ASSEMBLER_H
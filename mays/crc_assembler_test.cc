@@ -0,0 +1,170 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "crc_assembler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_test_util.h"
+
+namespace mays {
+namespace {
+
+// Chunk of a message, by offset and length.
+struct Chunk {
+  size_t offset;
+  size_t length;
+};
+
+// Splits a message of |length| octets into chunks of varying lengths, in shuffled order.
+std::vector<Chunk> MakeShuffledChunks(size_t length) {
+  std::vector<Chunk> chunks;
+  for (size_t offset = 0, i = 0; offset < length; i++) {
+    const size_t chunk_length = std::min(length - offset, 1 + (i * 37) % 100);
+    chunks.push_back({offset, chunk_length});
+    offset += chunk_length;
+  }
+  std::shuffle(chunks.begin(), chunks.end(), std::mt19937(1));
+  return chunks;
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Assemble CRCs of chunks in any order",
+                   "[crc_assembler]",
+                   Crc7Mmc,
+                   Crc16Arc,
+                   Crc24Openpgp,
+                   Crc32IsoHdlc,
+                   Crc64Xz) {
+  const std::vector<uint8_t> message = MakeMessage(5000);
+  const auto expected = Crc<TestType>::Compute(message.data(), message.size());
+  const std::vector<Chunk> chunks = MakeShuffledChunks(message.size());
+  REQUIRE(chunks.size() > 2);
+
+  CrcAssembler<TestType> assembler(message.size());
+  for (size_t i = 0; i < chunks.size(); i++) {
+    CAPTURE(i);
+    CHECK_FALSE(assembler.GetCheckValue().has_value());
+    const Chunk& chunk = chunks[i];
+    const auto result = assembler.Add(
+        chunk.offset,
+        Crc<TestType>::Compute(&message[chunk.offset], chunk.length),
+        chunk.length);
+    if (i + 1 < chunks.size()) {
+      CHECK(CrcAssemblerStatus::kAdded == result.status);
+      CHECK_FALSE(result.check_value.has_value());
+    } else {
+      CHECK(CrcAssemblerStatus::kCompleted == result.status);
+      CHECK(std::optional(expected) == result.check_value);
+    }
+  }
+  CHECK(std::optional(expected) == assembler.GetCheckValue());
+  CHECK(message.size() == assembler.GetCoveredLength());
+}
+
+TEST_CASE("Assemble CRCs of chunks from concurrent producers", "[crc_assembler]") {
+  using CrcType = Crc<Crc32Iscsi>;
+  const std::vector<uint8_t> message = MakeMessage(100000);
+  const std::vector<Chunk> chunks = MakeShuffledChunks(message.size());
+  CrcAssembler<Crc32Iscsi> assembler(message.size());
+
+  // Each thread adds every |kNumThreads|th chunk. Exactly one of them completes the message.
+  constexpr size_t kNumThreads = 4;
+  std::vector<std::optional<uint32_t>> completions(kNumThreads);
+  std::vector<std::thread> threads;
+  for (size_t thread_index = 0; thread_index < kNumThreads; thread_index++) {
+    threads.emplace_back([&, thread_index] {
+      for (size_t i = thread_index; i < chunks.size(); i += kNumThreads) {
+        const Chunk& chunk = chunks[i];
+        const auto result = assembler.Add(
+            chunk.offset, CrcType::Compute(&message[chunk.offset], chunk.length), chunk.length);
+        if (result.check_value.has_value()) {
+          completions[thread_index] = result.check_value;
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  const auto expected = CrcType::Compute(message.data(), message.size());
+  CHECK(1 == std::count(completions.begin(), completions.end(), std::optional(expected)));
+  CHECK(1 == std::count_if(completions.begin(), completions.end(),
+                           [](const auto& completion) { return completion.has_value(); }));
+  CHECK(std::optional(expected) == assembler.GetCheckValue());
+}
+
+TEST_CASE("Assemble CRCs of empty messages and chunks", "[crc_assembler]") {
+  CrcAssembler<Crc32IsoHdlc> empty_assembler(0);
+  CHECK(std::optional(Crc<Crc32IsoHdlc>::Compute("", 0)) == empty_assembler.GetCheckValue());
+  CHECK(CrcAssemblerStatus::kDuplicate ==
+        empty_assembler.Add(0, Crc<Crc32IsoHdlc>::Compute("", 0), 0).status);
+
+  CrcAssembler<Crc32IsoHdlc> assembler(9);
+  CHECK(CrcAssemblerStatus::kDuplicate ==
+        assembler.Add(4, Crc<Crc32IsoHdlc>::Compute("", 0), 0).status);
+  CHECK(CrcAssemblerStatus::kAdded ==
+        assembler.Add(4, Crc<Crc32IsoHdlc>::Compute("56789", 5), 5).status);
+  CHECK(5 == assembler.GetCoveredLength());
+  CHECK(std::optional(Crc<Crc32IsoHdlc>::Compute("123456789", 9)) ==
+        assembler.Add(0, Crc<Crc32IsoHdlc>::Compute("1234", 4), 4).check_value);
+
+  // Empty chunks after completion are duplicates too.
+  const auto result = assembler.Add(9, Crc<Crc32IsoHdlc>::Compute("", 0), 0);
+  CHECK(CrcAssemblerStatus::kDuplicate == result.status);
+  CHECK(std::nullopt == result.check_value);
+}
+
+TEST_CASE("Ignore duplicate chunks", "[crc_assembler]") {
+  using CrcType = Crc<Crc32IsoHdlc>;
+  CrcAssembler<Crc32IsoHdlc> assembler(9);
+  CHECK(CrcAssemblerStatus::kAdded == assembler.Add(0, CrcType::Compute("1234", 4), 4).status);
+  CHECK(CrcAssemblerStatus::kAdded == assembler.Add(6, CrcType::Compute("789", 3), 3).status);
+  CHECK(CrcAssemblerStatus::kDuplicate == assembler.Add(0, CrcType::Compute("1234", 4), 4).status);
+  CHECK(CrcAssemblerStatus::kDuplicate == assembler.Add(6, CrcType::Compute("789", 3), 3).status);
+  // Chunks within merged ranges are duplicates too.
+  CHECK(CrcAssemblerStatus::kDuplicate == assembler.Add(1, CrcType::Compute("23", 2), 2).status);
+  CHECK(7 == assembler.GetCoveredLength());
+
+  const auto expected = CrcType::Compute("123456789", 9);
+  const auto result = assembler.Add(4, CrcType::Compute("56", 2), 2);
+  CHECK(CrcAssemblerStatus::kCompleted == result.status);
+  CHECK(std::optional(expected) == result.check_value);
+
+  // Only the first chunk to complete the message returns its check value.
+  const auto duplicate_result = assembler.Add(4, CrcType::Compute("56", 2), 2);
+  CHECK(CrcAssemblerStatus::kDuplicate == duplicate_result.status);
+  CHECK_FALSE(duplicate_result.check_value.has_value());
+  CHECK(std::optional(expected) == assembler.GetCheckValue());
+}
+
+TEST_CASE("Ignore overlapping chunks", "[crc_assembler]") {
+  using CrcType = Crc<Crc32IsoHdlc>;
+  CrcAssembler<Crc32IsoHdlc> assembler(9);
+  CHECK(CrcAssemblerStatus::kAdded == assembler.Add(2, CrcType::Compute("345", 3), 3).status);
+
+  // Overlapping the start, the end, and all of the chunk added before.
+  CHECK(CrcAssemblerStatus::kOverlap == assembler.Add(0, CrcType::Compute("123", 3), 3).status);
+  CHECK(CrcAssemblerStatus::kOverlap == assembler.Add(4, CrcType::Compute("56", 2), 2).status);
+  CHECK(CrcAssemblerStatus::kOverlap == assembler.Add(1, CrcType::Compute("23456", 5), 5).status);
+  CHECK(3 == assembler.GetCoveredLength());
+
+  // Overlapping chunks leave the assembler able to complete the message.
+  CHECK(CrcAssemblerStatus::kAdded == assembler.Add(0, CrcType::Compute("12", 2), 2).status);
+  CHECK(CrcAssemblerStatus::kCompleted == assembler.Add(5, CrcType::Compute("6789", 4), 4).status);
+  CHECK(std::optional(CrcType::Compute("123456789", 9)) == assembler.GetCheckValue());
+}
+
+}  // namespace
+}  // namespace mays
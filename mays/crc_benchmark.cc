@@ -0,0 +1,458 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_hash.h"
+#include "crc_syndrome.h"
+#include "crc_test_util.h"
+#include "dynamic_crc.h"
+#include "multi_crc.h"
+
+namespace mays {
+namespace {
+
+// Throughput of every catalog model over message lengths from 8 octets to 64 MiB, for each way of
+// appending data. Hidden because it takes minutes to run; select it with the "[throughput]" tag.
+// Each benchmark is named "<operation> <length> octets" so that results can be converted to
+// bytes per second and cycles per byte from the XML reporter's output using
+// tools/crc_benchmark_report.py, e.g.
+//   mays_benchmarks "[throughput]" --reporter XML | tools/crc_benchmark_report.py > crc.csv
+// The models are listed here rather than taken from CrcCatalogModels because the report reads the
+// model name from the end of each test case name, which TEMPLATE_LIST_TEST_CASE replaces with an
+// index.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs of each catalog model",
+                   "[crc][.throughput]",
+                   Crc6Darc,
+                   Crc7Mmc,
+                   Crc8Bluetooth,
+                   Crc15Can,
+                   Crc16Arc,
+                   Crc16Xmodem,
+                   Crc17CanFd,
+                   Crc21CanFd,
+                   Crc24Ble,
+                   Crc24Openpgp,
+                   Crc32Bzip2,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Ecma182,
+                   Crc64Xz) {
+  using CrcType = Crc<TestType>;
+  constexpr size_t kMaxLength = size_t{64} << 20;
+  // AppendBits processes at most an octet per table look-up, so longer messages take too long.
+  constexpr size_t kMaxBitsLength = size_t{1} << 20;
+  // Chunk length for appending, like reading a stream into a buffer.
+  constexpr size_t kAppendChunkLength = size_t{4} << 10;
+  static const std::vector<uint8_t> buffer = MakeMessage(kMaxLength);
+
+  for (const size_t length : {size_t{8},
+                              size_t{64},
+                              size_t{512},
+                              size_t{4} << 10,
+                              size_t{64} << 10,
+                              size_t{1} << 20,
+                              size_t{16} << 20,
+                              kMaxLength}) {
+    const std::string length_suffix = " " + std::to_string(length) + " octets";
+    BENCHMARK("Compute" + length_suffix) {
+      return CrcType::Compute(buffer.data(), length);
+    };
+    BENCHMARK("AppendOctets" + length_suffix) {
+      CrcType crc;
+      for (size_t offset = 0; offset < length; offset += kAppendChunkLength) {
+        crc.AppendOctets(&buffer[offset], std::min(kAppendChunkLength, length - offset));
+      }
+      return crc.GetCheckValue();
+    };
+    if (length <= kMaxBitsLength) {
+      BENCHMARK("AppendBits" + length_suffix) {
+        CrcType crc;
+        for (size_t offset = 0; offset < length; offset += sizeof(uint64_t)) {
+          uint64_t word = 0;
+          std::memcpy(&word, &buffer[offset], sizeof(word));
+          crc.template AppendBits<64>(word);
+        }
+        return crc.GetCheckValue();
+      };
+    }
+  }
+}
+
+// Trade-off between table memory and throughput of each table policy, and the cost of tables
+// generated on first use after they have been generated. Messages are kept shorter than those that
+// are folded using carry-less multiplication (where available), which doesn't use the tables.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs with each table policy",
+                   "[crc][table_policy]",
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kBitwise>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kNibble>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kOctet>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy16>),
+                   (Crc<Crc64Xz, CrcTablePolicy::kBitwise>),
+                   (Crc<Crc64Xz, CrcTablePolicy::kNibble>),
+                   (Crc<Crc64Xz, CrcTablePolicy::kOctet>),
+                   (Crc<Crc64Xz, CrcTablePolicy::kSliceBy8>),
+                   (Crc<Crc64Xz, CrcTablePolicy::kSliceBy16>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kOctet, CrcTableInit::kOnFirstUse>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy16, CrcTableInit::kOnFirstUse>)) {
+  for (const size_t length : {16, 64, 127}) {
+    const std::vector<uint8_t> message = MakeMessage(length);
+    BENCHMARK(std::to_string(length) + " octets") {
+      return TestType::Compute(message.data(), message.size());
+    };
+  }
+}
+
+// Models with parameters known only at run time, compared to the same model at compile time.
+TEST_CASE("Compute dynamic CRCs", "[crc][dynamic_crc]") {
+  const DynamicCrc crc_model(DynamicCrcParameters::FromTraits<Crc32IsoHdlc>());
+  for (const size_t length : {16, 64, 127}) {
+    const std::vector<uint8_t> message = MakeMessage(length);
+    BENCHMARK("DynamicCrc " + std::to_string(length) + " octets") {
+      return crc_model.Compute(message.data(), message.size());
+    };
+    BENCHMARK("Crc kOctet " + std::to_string(length) + " octets") {
+      return Crc<Crc32IsoHdlc>::Compute(message.data(), message.size());
+    };
+    BENCHMARK("Crc kSliceBy8 " + std::to_string(length) + " octets") {
+      return Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>::Compute(message.data(), message.size());
+    };
+  }
+}
+
+// Messages fragmented into segments of varying lengths, e.g. a chain of network buffers.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs over segments",
+                   "[crc][segments]",
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>),
+                   (Crc<Crc32Iscsi>),
+                   (Crc<Crc64Xz>)) {
+  const std::vector<uint8_t> buffer = MakeMessage(size_t{64} << 10);
+  std::vector<std::span<const uint8_t>> segments;
+  for (size_t offset = 0, i = 0; offset < buffer.size(); i++) {
+    // Lengths between 1 and 200 octets.
+    const size_t length = std::min(1 + (i * 89) % 200, buffer.size() - offset);
+    segments.emplace_back(&buffer[offset], length);
+    offset += length;
+  }
+
+  BENCHMARK("AppendOctets on each segment") {
+    TestType crc;
+    for (const auto segment : segments) {
+      crc.AppendOctets(segment.data(), segment.size());
+    }
+    return crc.GetCheckValue();
+  };
+  BENCHMARK("AppendSegments") {
+    TestType crc;
+    crc.AppendSegments(segments);
+    return crc.GetCheckValue();
+  };
+}
+
+// Copying a message and computing its CRC, in two passes or one. The largest length exceeds typical
+// L2 and L3 caches, so each pass reads from memory.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Copy and compute CRCs", "[crc][copy]", Crc<Crc32IsoHdlc>, Crc<Crc32Iscsi>) {
+  for (const size_t length : {size_t{64} << 10, size_t{1} << 20, size_t{64} << 20}) {
+    const std::vector<uint8_t> source = MakeMessage(length);
+    std::vector<uint8_t> destination(length);
+    const std::string length_suffix = " " + std::to_string(length) + " octets";
+    BENCHMARK("memcpy then Compute" + length_suffix) {
+      std::memcpy(destination.data(), source.data(), length);
+      return TestType::Compute(destination.data(), length);
+    };
+    BENCHMARK("CopyAndAppend" + length_suffix) {
+      TestType crc;
+      crc.CopyAndAppend(destination.data(), source.data(), length);
+      return crc.GetCheckValue();
+    };
+  }
+}
+
+// Two models over the same message, in two passes or one. The largest length exceeds typical L2 and
+// L3 caches, so each pass reads from memory.
+TEST_CASE("Compute CRCs of several models", "[crc][multi_crc]") {
+  for (const size_t length : {size_t{64} << 10, size_t{1} << 20, size_t{64} << 20}) {
+    const std::vector<uint8_t> message = MakeMessage(length);
+    const std::string length_suffix = " " + std::to_string(length) + " octets";
+    BENCHMARK("Compute for each model" + length_suffix) {
+      using Crc32 = Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>;
+      using Crc64 = Crc<Crc64Xz, CrcTablePolicy::kSliceBy8>;
+      return std::tuple(Crc32::Compute(message.data(), length),
+                        Crc64::Compute(message.data(), length));
+    };
+    BENCHMARK("MultiCrc" + length_suffix) {
+      return MultiCrc<Crc32IsoHdlc, Crc64Xz>::Compute(message.data(), length);
+    };
+  }
+}
+
+// Batches of fixed-length records that each end in a check value.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Verify batches of records",
+                   "[crc][records]",
+                   Crc8Bluetooth,
+                   Crc16Xmodem) {
+  using CrcType = Crc<TestType>;
+  constexpr size_t kNumRecords = 64;
+  constexpr size_t kCheckValueLength = Crc<TestType>::kCheckValueLength;
+  for (const size_t record_length : {8, 16, 32}) {
+    const std::vector<uint8_t> records = MakeMessage(record_length * kNumRecords);
+    const std::string length_suffix = " " + std::to_string(record_length) + " octets";
+    BENCHMARK("Compute on each record" + length_suffix) {
+      uint64_t passed = 0;
+      for (size_t i = 0; i < kNumRecords; i++) {
+        const uint8_t* const record = &records[i * record_length];
+        const size_t payload_length = record_length - kCheckValueLength;
+        typename CrcType::RegisterType stored_check_value = 0;
+        for (size_t j = 0; j < kCheckValueLength; j++) {
+          stored_check_value = static_cast<typename CrcType::RegisterType>(
+              (stored_check_value << 8) | record[payload_length + j]);  // NOLINT
+        }
+        passed |= uint64_t{CrcType::Compute(record, payload_length) == stored_check_value} << i;
+      }
+      return passed;
+    };
+    BENCHMARK("VerifyRecords" + length_suffix) {
+      uint64_t passed = 0;
+      CrcType::VerifyRecords(records.data(), record_length, kNumRecords, std::span(&passed, 1));
+      return passed;
+    };
+  }
+}
+
+// Batches of short, independent messages.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs of many short messages",
+                   "[crc][many]",
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kOctet>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>),
+                   (Crc<Crc64Xz, CrcTablePolicy::kOctet>)) {
+  constexpr size_t kNumMessages = 1024;
+  const std::vector<uint8_t> buffer = MakeMessage(kNumMessages * 256);
+  std::vector<std::span<const uint8_t>> messages;
+  for (size_t i = 0; i < kNumMessages; i++) {
+    // Lengths between 16 and 256 octets.
+    const size_t length = 16 + (i * 97) % 241;  // NOLINT(readability-magic-numbers)
+    messages.emplace_back(&buffer.at(i * 256), length);
+  }
+  std::vector<typename TestType::RegisterType> check_values(kNumMessages);
+
+  BENCHMARK("Compute in a loop") {
+    for (size_t i = 0; i < kNumMessages; i++) {
+      check_values[i] = TestType::Compute(messages[i].data(), messages[i].size());
+    }
+    return check_values.back();
+  };
+  BENCHMARK("ComputeMany") {
+    TestType::ComputeMany(messages, check_values);
+    return check_values.back();
+  };
+}
+
+// Unaligned bit-oriented frames, e.g. de-stuffed CAN FD frames.
+TEST_CASE("Compute CRCs over bit spans", "[crc][bit_span]") {
+  using CrcType = Crc<Crc17CanFd>;
+  const std::vector<uint8_t> frame = MakeMessage(16);
+  constexpr size_t kBitOffset = 3;
+  constexpr size_t kBitCount = 117;
+
+  BENCHMARK("AppendBits<1> in a loop") {
+    CrcType crc;
+    for (size_t i = kBitOffset; i < kBitOffset + kBitCount; i++) {
+      crc.AppendBits<1>(frame[i / 8] >> (7 - i % 8));
+    }
+    return crc.GetCheckValue();
+  };
+  BENCHMARK("AppendBitSpan") {
+    CrcType crc;
+    crc.AppendBitSpan(frame.data(), kBitOffset, kBitCount);
+    return crc.GetCheckValue();
+  };
+}
+
+// Structured records checksummed field by field, e.g. serialized headers.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs over integer values",
+                   "[crc][values]",
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kOctet>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>)) {
+  std::vector<uint64_t> values(512);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = 0x9e37'79b9'7f4a'7c15 * (i + 1);  // NOLINT(readability-magic-numbers)
+  }
+  // The same values laid out in memory in little-endian order.
+  std::vector<uint8_t> octets(values.size() * sizeof(uint64_t));
+  for (size_t i = 0; i < octets.size(); i++) {
+    octets[i] = static_cast<uint8_t>(values[i / 8] >> (8 * (i % 8)));
+  }
+
+  BENCHMARK("AppendOctets on each octet") {
+    TestType crc;
+    for (const uint64_t value : values) {
+      for (size_t i = 0; i < sizeof(value); i++) {
+        const auto octet = static_cast<uint8_t>(value >> (8 * i));
+        crc.AppendOctets(&octet, 1);
+      }
+    }
+    return crc.GetCheckValue();
+  };
+  BENCHMARK("AppendValue") {
+    TestType crc;
+    for (const uint64_t value : values) {
+      crc.template AppendValue<CrcByteOrder::kLittleEndian>(value);
+    }
+    return crc.GetCheckValue();
+  };
+  BENCHMARK("AppendOctets on raw octets") {
+    return TestType::Compute(octets.data(), octets.size());
+  };
+}
+
+// Short messages whose lengths are known at compile time, e.g. CAN payloads and packet headers.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs over fixed-length messages",
+                   "[crc][fixed_length]",
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kOctet>),
+                   (Crc<Crc32IsoHdlc, CrcTablePolicy::kSliceBy8>),
+                   (Crc<Crc32Iscsi, CrcTablePolicy::kSliceBy8>)) {
+  constexpr size_t kMessageCount = 256;
+  constexpr auto kBenchmarkLength = []<size_t Length>() {
+    std::vector<std::array<uint8_t, Length>> messages(kMessageCount);
+    for (size_t i = 0; i < messages.size(); i++) {
+      for (size_t j = 0; j < Length; j++) {
+        messages[i][j] = static_cast<uint8_t>(i * 0x9e + j * 0x37);  // NOLINT
+      }
+    }
+    const std::string length_suffix = " (" + std::to_string(Length) + " octets)";
+    BENCHMARK("Compute with runtime length" + length_suffix) {
+      uint64_t sum = 0;
+      for (const auto& message : messages) {
+        sum += TestType::Compute(message.data(), message.size());
+      }
+      return sum;
+    };
+    BENCHMARK("Compute with fixed length" + length_suffix) {
+      uint64_t sum = 0;
+      for (const auto& message : messages) {
+        sum += TestType::Compute(std::span(message));
+      }
+      return sum;
+    };
+  };
+  kBenchmarkLength.template operator()<4>();
+  kBenchmarkLength.template operator()<8>();
+  kBenchmarkLength.template operator()<20>();
+  kBenchmarkLength.template operator()<64>();
+}
+
+// Correcting a single-bit error in a BLE advertising PDU by flipping each bit in turn until the
+// CRC matches, or by looking up its syndrome.
+TEST_CASE("Correct single-bit errors", "[crc][syndrome]") {
+  using Crc24 = Crc<Crc24Ble, CrcTablePolicy::kSliceBy8>;
+  constexpr size_t kLength = 39;
+  const std::vector<uint8_t> message = MakeMessage(kLength);
+  const auto check_value = Crc24::Compute(message.data(), kLength);
+  for (const size_t error_index : {size_t{0}, size_t{8} * kLength / 2}) {
+    std::vector<uint8_t> received = message;
+    received[error_index / 8] ^= static_cast<uint8_t>(1U << (error_index % 8));
+    const std::string index_suffix = " (bit " + std::to_string(error_index) + ")";
+    BENCHMARK("Flip each bit and Compute" + index_suffix) {
+      for (size_t index = 0; index < 8 * kLength; index++) {
+        received[index / 8] ^= static_cast<uint8_t>(1U << (index % 8));
+        const bool matches = Crc24::Compute(received.data(), kLength) == check_value;
+        received[index / 8] ^= static_cast<uint8_t>(1U << (index % 8));
+        if (matches) {
+          return index;
+        }
+      }
+      return ~size_t{};
+    };
+    BENCHMARK("CrcSyndromeTable::Locate" + index_suffix) {
+      const auto syndrome =
+          static_cast<uint32_t>(check_value ^ Crc24::Compute(received.data(), kLength));
+      return CrcSyndromeTable<Crc24Ble, 255>::Locate(syndrome, kLength);
+    };
+  }
+}
+
+// Hash table keys: short strings and 64-bit IDs, both sequential and with only high bits varying.
+// Besides throughput, reports how evenly each hash spreads the keys over 2^16 buckets selected by
+// the low bits of the hash, as open-addressing tables do.
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Hash keys",
+                   "[crc][hash]",
+                   std::hash<uint64_t>,
+                   CrcHash<Crc32Iscsi>,
+                   CrcHash<Crc64Xz>) {
+  constexpr size_t kNumKeys = size_t{1} << 16;
+  constexpr size_t kBucketMask = kNumKeys - 1;
+  const TestType hash;
+  using StringHash =
+      std::conditional_t<std::is_same_v<TestType, std::hash<uint64_t>>, std::hash<std::string_view>,
+                         TestType>;
+  const StringHash string_hash;
+
+  std::vector<uint64_t> sequential_ids(kNumKeys);
+  std::vector<uint64_t> strided_ids(kNumKeys);
+  std::vector<std::string> strings(kNumKeys);
+  for (size_t i = 0; i < kNumKeys; i++) {
+    sequential_ids[i] = i;
+    strided_ids[i] = uint64_t{i} << 20;
+    strings[i] = "user:" + std::to_string(i * 7919) + "@example.com";  // NOLINT
+  }
+
+  const auto report_distribution = [](const char* name, const auto& keys, const auto& hasher) {
+    std::vector<size_t> bucket_loads(kNumKeys);
+    for (const auto& key : keys) {
+      bucket_loads[hasher(key) & kBucketMask]++;
+    }
+    const auto num_empty =
+        static_cast<size_t>(std::count(bucket_loads.begin(), bucket_loads.end(), 0));
+    const size_t max_load = *std::max_element(bucket_loads.begin(), bucket_loads.end());
+    // Ideally about 1/e (37%) of buckets are empty and the fullest bucket holds about 8 keys.
+    WARN(name << ": " << num_empty * 100 / kNumKeys << "% of buckets empty, max load "
+              << max_load);
+  };
+  report_distribution("Sequential IDs", sequential_ids, hash);
+  report_distribution("Strided IDs", strided_ids, hash);
+  report_distribution("Strings", strings, string_hash);
+
+  BENCHMARK("Sequential IDs") {
+    size_t sum = 0;
+    for (const uint64_t id : sequential_ids) {
+      sum += hash(id);
+    }
+    return sum;
+  };
+  BENCHMARK("Strings") {
+    size_t sum = 0;
+    for (const std::string& string : strings) {
+      sum += string_hash(string);
+    }
+    return sum;
+  };
+}
+
+}  // namespace
+}  // namespace mays
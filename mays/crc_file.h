@@ -0,0 +1,185 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_FILE_H
+#define MAYS_CRC_FILE_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "crc.h"
+
+namespace mays {
+
+// Result of computing the CRC of a file.
+template <typename RegisterType>
+struct CrcFileResult {
+  RegisterType check_value;
+  uint64_t length;
+  std::chrono::steady_clock::duration elapsed;
+
+  // Throughput of the computation, including mapping or reading the file.
+  [[nodiscard]] double GetBytesPerSecond() const {
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0 ? static_cast<double>(length) / seconds : 0;
+  }
+};
+
+struct CrcFileOptions {
+  // Files longer than this many octets are read into a buffer with pread(2) instead of being
+  // mapped into memory, to avoid exhausting address space.
+  uint64_t max_map_length = uint64_t{1} << (sizeof(size_t) >= sizeof(uint64_t) ? 40 : 30);
+  // Length of the buffer used when reading with pread(2).
+  size_t read_buffer_length = size_t{1} << 20;
+};
+
+namespace detail {
+
+// Octets of a mapped file to hint for readahead at a time, and ahead of the CRC computation.
+inline constexpr size_t kCrcFileReadaheadLength = size_t{1} << 23;
+
+// Maps the first |length| octets of the file and computes their CRC. Returns std::nullopt if the
+// file can not be mapped, or if it is found to be shorter than |length| before any readahead window,
+// as accessing mapped pages past its end raises SIGBUS.
+template <typename CrcType>
+[[nodiscard]] std::optional<typename CrcType::RegisterType> ComputeCrcOfMappedFile(int fd,
+                                                                                    size_t length) {
+  void* const mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+  if (mapping == MAP_FAILED) {
+    return std::nullopt;
+  }
+
+  // Advice is only a hint, so failures are ignored.
+  (void)madvise(mapping, length, MADV_SEQUENTIAL);
+  auto* const data = static_cast<uint8_t*>(mapping);
+  CrcType crc;
+  for (size_t offset = 0; offset < length; offset += kCrcFileReadaheadLength) {
+    // Stop before touching pages that are no longer backed by the file, e.g. because it was
+    // truncated by another process. This can't catch truncation during a window.
+    struct stat file_status = {};
+    if (fstat(fd, &file_status) != 0 || file_status.st_size < 0 ||
+        static_cast<uint64_t>(file_status.st_size) < length) {
+      (void)munmap(mapping, length);
+      return std::nullopt;
+    }
+    // Request the window after this one so that it is read in while this window is processed.
+    const size_t next_offset = offset + kCrcFileReadaheadLength;
+    if (next_offset < length) {
+      const size_t next_length = std::min(kCrcFileReadaheadLength, length - next_offset);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      (void)madvise(data + next_offset, next_length, MADV_WILLNEED);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    crc.AppendOctets(data + offset, std::min(kCrcFileReadaheadLength, length - offset));
+  }
+  (void)munmap(mapping, length);
+  return crc.GetCheckValue();
+}
+
+// Reads the file from its beginning to its end with pread(2) into a buffer of |buffer_length|
+// octets. Returns the CRC and length of its contents, or std::nullopt if a read fails.
+template <typename CrcType>
+[[nodiscard]] std::optional<CrcFileResult<typename CrcType::RegisterType>> ComputeCrcOfReadFile(
+    int fd,
+    size_t buffer_length) {
+  std::vector<uint8_t> buffer(buffer_length > 0 ? buffer_length : 1);
+  CrcType crc;
+  uint64_t offset = 0;
+  while (true) {
+    const ssize_t read_length = pread(fd, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+    if (read_length < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return std::nullopt;
+    }
+    if (read_length == 0) {
+      break;
+    }
+    crc.AppendOctets(buffer.data(), static_cast<size_t>(read_length));
+    offset += static_cast<uint64_t>(read_length);
+  }
+  return CrcFileResult<typename CrcType::RegisterType>{crc.GetCheckValue(), offset, {}};
+}
+
+}  // namespace detail
+
+// Computes the same check value as |CrcType::Compute| on the contents of the file open for reading
+// as |fd|, from its beginning to its end. |CrcType| is a Crc instantiation, e.g. Crc<Crc32IsoHdlc>.
+// The file must be seekable. Returns std::nullopt if the file can not be read. |fd| is not closed.
+//
+// Regular files are mapped into memory and processed without copying, with madvise(2) hints to read
+// them sequentially and ahead of the computation. Files longer than |options.max_map_length|, that
+// can not be mapped, or that report a length of zero are instead read into a buffer in sequence.
+//
+// A mapped file must not shrink while it is being checksummed: reading a page past its new end
+// raises SIGBUS, which terminates the process instead of returning std::nullopt. The file's length
+// is checked before each 8 MiB window and the whole file is read instead if it has shrunk, but
+// truncation during a window can't be detected. Set |options.max_map_length| to 0 to always read
+// files that other processes may truncate.
+//
+// Example:
+//   if (const auto result = ComputeCrcOfFile<Crc<Crc32Iscsi>>(fd)) {
+//     std::printf("%08x (%.0f B/s)\n", result->check_value, result->GetBytesPerSecond());
+//   }
+template <typename CrcType>
+[[nodiscard]] std::optional<CrcFileResult<typename CrcType::RegisterType>> ComputeCrcOfFile(
+    int fd,
+    const CrcFileOptions& options = {}) {
+  const auto start_time = std::chrono::steady_clock::now();
+  auto get_elapsed = [start_time] { return std::chrono::steady_clock::now() - start_time; };
+
+  struct stat file_status = {};
+  if (fstat(fd, &file_status) != 0) {
+    return std::nullopt;
+  }
+  // Files reported as empty may still have contents, e.g. those in procfs and sysfs, so they are
+  // read instead.
+  if (S_ISREG(file_status.st_mode) && file_status.st_size > 0) {
+    const auto length = static_cast<uint64_t>(file_status.st_size);
+    if (length <= options.max_map_length && length <= std::numeric_limits<size_t>::max()) {
+      if (const auto check_value =
+              detail::ComputeCrcOfMappedFile<CrcType>(fd, static_cast<size_t>(length))) {
+        return CrcFileResult<typename CrcType::RegisterType>{*check_value, length, get_elapsed()};
+      }
+    }
+  }
+
+  auto result = detail::ComputeCrcOfReadFile<CrcType>(fd, options.read_buffer_length);
+  if (result) {
+    result->elapsed = get_elapsed();
+  }
+  return result;
+}
+
+// Computes the check value of the file at |path|. See the overload above taking a file descriptor.
+template <typename CrcType>
+[[nodiscard]] std::optional<CrcFileResult<typename CrcType::RegisterType>> ComputeCrcOfFile(
+    const char* path,
+    const CrcFileOptions& options = {}) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-signed-bitwise)
+  const int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return std::nullopt;
+  }
+  auto result = ComputeCrcOfFile<CrcType>(fd, options);
+  (void)close(fd);
+  return result;
+}
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_FILE_H
@@ -0,0 +1,112 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "crc_file.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_test_util.h"
+
+namespace mays {
+namespace {
+
+// Temporary file with the given contents, deleted on destruction.
+class TemporaryFile {
+ public:
+  explicit TemporaryFile(const std::vector<uint8_t>& contents) {
+    const char* const temp_dir = std::getenv("TMPDIR");  // NOLINT(concurrency-mt-unsafe)
+    path_ = std::string(temp_dir != nullptr ? temp_dir : "/tmp") + "/mays_crc_file_XXXXXX";
+    const int fd = mkstemp(path_.data());
+    REQUIRE(fd >= 0);
+    size_t offset = 0;
+    while (offset < contents.size()) {
+      const ssize_t written = write(fd, &contents[offset], contents.size() - offset);
+      REQUIRE(written > 0);
+      offset += static_cast<size_t>(written);
+    }
+    REQUIRE(close(fd) == 0);
+  }
+  TemporaryFile(const TemporaryFile&) = delete;
+  TemporaryFile& operator=(const TemporaryFile&) = delete;
+  ~TemporaryFile() { (void)unlink(path_.c_str()); }
+
+  [[nodiscard]] const char* path() const { return path_.c_str(); }
+
+ private:
+  std::string path_;
+};
+
+TEST_CASE("Compute CRC of file", "[crc_file]") {
+  using CrcType = Crc<Crc32IsoHdlc>;
+
+  // Longer than a readahead window, so that several windows are processed.
+  for (const size_t length : {size_t{0}, size_t{1}, size_t{4099}, (size_t{1} << 23) + 5}) {
+    CAPTURE(length);
+    const std::vector<uint8_t> contents = MakeMessage(length);
+    const TemporaryFile file(contents);
+    const auto expected = CrcType::Compute(contents.data(), contents.size());
+
+    SECTION("Mapped") {
+      const auto result = ComputeCrcOfFile<CrcType>(file.path());
+      REQUIRE(result.has_value());
+      CHECK(expected == result->check_value);
+      CHECK(length == result->length);
+      CHECK(result->GetBytesPerSecond() >= 0);
+    }
+
+    SECTION("Read") {
+      // Force reading into a buffer, with a buffer length that doesn't divide the file length.
+      const auto result =
+          ComputeCrcOfFile<CrcType>(file.path(), {.max_map_length = 0, .read_buffer_length = 1000});
+      REQUIRE(result.has_value());
+      CHECK(expected == result->check_value);
+      CHECK(length == result->length);
+    }
+  }
+}
+
+TEST_CASE("Compute CRC of file that reports a length of zero", "[crc_file]") {
+  // procfs files have a length of zero but still have contents. The command line of this process
+  // doesn't change while it runs.
+  constexpr const char* kPath = "/proc/self/cmdline";
+  std::ifstream stream(kPath, std::ios::binary);
+  REQUIRE(stream.is_open());
+  const std::vector<uint8_t> contents{std::istreambuf_iterator<char>(stream),
+                                      std::istreambuf_iterator<char>()};
+  REQUIRE_FALSE(contents.empty());
+
+  const auto result = ComputeCrcOfFile<Crc<Crc32IsoHdlc>>(kPath);
+  REQUIRE(result.has_value());
+  CHECK(Crc<Crc32IsoHdlc>::Compute(contents.data(), contents.size()) == result->check_value);
+  CHECK(contents.size() == result->length);
+}
+
+TEST_CASE("Compute CRC of mapped file that is shorter than expected", "[crc_file]") {
+  // As if the file were truncated after its length was read, with more than a readahead window
+  // left past its new end.
+  const TemporaryFile file(MakeMessage(4099));
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-signed-bitwise)
+  const int fd = open(file.path(), O_RDONLY | O_CLOEXEC);
+  REQUIRE(fd >= 0);
+  CHECK_FALSE(detail::ComputeCrcOfMappedFile<Crc<Crc32IsoHdlc>>(fd, size_t{1} << 24).has_value());
+  (void)close(fd);
+}
+
+TEST_CASE("Compute CRC of missing file", "[crc_file]") {
+  CHECK_FALSE(ComputeCrcOfFile<Crc<Crc32IsoHdlc>>("/nonexistent/mays_crc_file").has_value());
+}
+
+}  // namespace
+}  // namespace mays
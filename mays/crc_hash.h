@@ -0,0 +1,81 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_HASH_H
+#define MAYS_CRC_HASH_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "crc.h"
+
+namespace mays {
+
+// Hash functor for hash tables that hashes keys by computing their CRC, e.g. for
+// std::unordered_map<std::string, Value, CrcHash<Crc32Iscsi>, std::equal_to<>>. With CRC-32C models
+// (e.g. Crc32Iscsi), keys are hashed eight octets at a time with the SSE4.2 CRC32 instruction on
+// CPUs that support it, and otherwise with the look-up tables of |TablePolicy|.
+//
+// Integer keys are hashed as a single word of little-endian octets, without a loop. Strings are
+// hashed as their octets, and heterogeneous look-up is supported so that std::string_view and
+// C strings can be looked up in tables keyed on std::string.
+//
+// The CRC is followed by a multiplicative mix, so that keys differing in only a few bits (e.g.
+// sequential IDs), which a CRC maps linearly onto a subset of its values, are spread over all
+// buckets of tables that select buckets by the low bits of the hash (e.g. power-of-two tables).
+//
+// The hash is seeded by using |seed| (truncated to the polynomial width) as the CRC's initial
+// value. A CRC is linear in its message and the mix is invertible, so keys chosen by an adversary
+// can be made to collide regardless of the seed. Use a keyed cryptographic hash for untrusted keys.
+//
+// Example:
+//   const CrcHash<Crc32Iscsi> hash(seed);
+//   size_t id_hash = hash(uint64_t{12345});
+//   size_t name_hash = hash("name");
+template <typename Traits, CrcTablePolicy TablePolicy = CrcTablePolicy::kSliceBy8>
+class CrcHash {
+ public:
+  using is_transparent = void;
+
+  constexpr CrcHash() = default;
+  constexpr explicit CrcHash(uint64_t seed)
+      : initial_value_(static_cast<RegisterType>(seed & kInitialValueMask)) {}
+
+  [[nodiscard]] constexpr size_t operator()(std::string_view key) const {
+    CrcType crc(initial_value_);
+    crc.AppendOctets(key.data(), key.size());
+    return Mix(crc.GetCheckValue());
+  }
+
+  template <std::integral Key>
+  [[nodiscard]] constexpr size_t operator()(Key key) const {
+    CrcType crc(initial_value_);
+    crc.template AppendValue<CrcByteOrder::kLittleEndian>(key);
+    return Mix(crc.GetCheckValue());
+  }
+
+ private:
+  using CrcType = Crc<Traits, TablePolicy>;
+  using RegisterType = typename CrcType::RegisterType;
+
+  // Multiplies by 2^64 divided by the golden ratio to carry every bit of |check_value| into the
+  // high half, then folds the high half into the low half that is kept by narrower |size_t| and
+  // used by power-of-two tables.
+  [[nodiscard]] static constexpr size_t Mix(uint64_t check_value) {
+    uint64_t hash = check_value * 0x9e37'79b9'7f4a'7c15;  // NOLINT(readability-magic-numbers)
+    hash ^= hash >> 32;
+    return static_cast<size_t>(hash);
+  }
+
+  static constexpr auto kInitialValueMask =
+      detail::MaskLowBits<uint64_t, Traits::kPolynomialBitWidth>();
+
+  RegisterType initial_value_ = Traits::kInitialValue;
+};
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_HASH_H
@@ -0,0 +1,99 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "crc_hash.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+
+namespace mays {
+namespace {
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Hash keys with CRCs",
+                   "[crc_hash]",
+                   Crc15Can,
+                   Crc16Arc,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Xz) {
+  static_assert(CrcHash<TestType>()("123456789") ==
+                CrcHash<TestType, CrcTablePolicy::kOctet>()(std::string_view("123456789")));
+  constexpr std::string_view kKey = "the quick brown fox";
+  CHECK(CrcHash<TestType>()(kKey) == CrcHash<TestType, CrcTablePolicy::kOctet>()(kKey));
+  CHECK(CrcHash<TestType>()(kKey) == CrcHash<TestType>()(std::string(kKey)));
+  CHECK(CrcHash<TestType>()(kKey) != CrcHash<TestType>()(kKey.substr(1)));
+
+  SECTION("Integers are hashed as little-endian octets") {
+    CHECK(CrcHash<TestType>()(std::string_view("\x15\x7c\x4a\x7f\xb9\x79\x37\x9e", 8)) ==
+          CrcHash<TestType>()(uint64_t{0x9e37'79b9'7f4a'7c15}));
+    CHECK(CrcHash<TestType>()(std::string_view("\xfe\xff\xff\xff", 4)) ==
+          CrcHash<TestType>()(int32_t{-2}));
+    CHECK(CrcHash<TestType>()(std::string_view("a", 1)) == CrcHash<TestType>()('a'));
+  }
+
+  SECTION("Seeded") {
+    // Seeds are the initial value of the CRC.
+    constexpr uint64_t kSeed = 0x1234;
+    CHECK(CrcHash<TestType>(TestType::kInitialValue)(kKey) == CrcHash<TestType>()(kKey));
+    CHECK(CrcHash<TestType>(kSeed)(kKey) != CrcHash<TestType>(kSeed + 1)(kKey));
+    CHECK(CrcHash<TestType>(kSeed)(uint64_t{1}) != CrcHash<TestType>(kSeed + 1)(uint64_t{1}));
+    // Seed bits above the polynomial width are ignored.
+    if constexpr (TestType::kPolynomialBitWidth < 64) {
+      constexpr uint64_t kHighBit = uint64_t{1} << TestType::kPolynomialBitWidth;
+      CHECK(CrcHash<TestType>(kSeed)(kKey) == CrcHash<TestType>(kSeed | kHighBit)(kKey));
+    }
+  }
+
+  SECTION("Sequential keys fill every bucket of power-of-two tables") {
+    // Without mixing, sequential keys in some bit positions (e.g. key << 12 for CRC-64/XZ) are
+    // mapped by the linear CRC onto only half of the buckets.
+    for (const size_t bucket_count : {size_t{16}, size_t{256}}) {
+      for (const int shift : {0, 3, 12, 32, 52}) {
+        CAPTURE(bucket_count, shift);
+        std::vector<bool> filled(bucket_count);
+        for (uint64_t key = 0; key < 16 * bucket_count; key++) {
+          filled[CrcHash<TestType>()(key << shift) & (bucket_count - 1)] = true;
+        }
+        CHECK(std::count(filled.begin(), filled.end(), true) == std::ssize(filled));
+      }
+    }
+  }
+}
+
+TEST_CASE("Mix CRCs into hashes", "[crc_hash]") {
+  // CRC-32C of "123456789" is 0xe3069283.
+  static_assert(CrcHash<Crc32Iscsi>()("123456789") ==
+                static_cast<size_t>(0xf007'1c4a'd558'64f5));  // NOLINT(readability-magic-numbers)
+}
+
+TEST_CASE("Look up keys in hash tables using CRC hashes", "[crc_hash]") {
+  std::unordered_map<std::string, int, CrcHash<Crc32Iscsi>, std::equal_to<>> table(
+      0, CrcHash<Crc32Iscsi>(42));
+  table["one"] = 1;
+  table["two"] = 2;
+  // Heterogeneous look-up without constructing std::string.
+  CHECK(table.find(std::string_view("two"))->second == 2);
+  CHECK(table.find("three") == table.end());
+
+  std::unordered_map<uint64_t, int, CrcHash<Crc64Xz>> ids;
+  for (uint64_t id = 0; id < 1000; id++) {
+    ids[id << 32] = static_cast<int>(id);
+  }
+  CHECK(ids.size() == 1000);
+  CHECK(ids.at(uint64_t{999} << 32) == 999);
+}
+
+}  // namespace
+}  // namespace mays
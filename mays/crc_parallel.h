@@ -0,0 +1,106 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_PARALLEL_H
+#define MAYS_CRC_PARALLEL_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "crc.h"
+#include "internal/check.h"
+
+namespace mays {
+namespace detail {
+
+// Executor that runs each task on its own thread, with task 0 on the calling thread. The threads
+// are joined on return, including when starting a thread or task 0 throws.
+inline constexpr auto kRunCrcTasksOnThreads = []<std::invocable<size_t> Task>(size_t num_tasks,
+                                                                              Task&& task) {
+  std::vector<std::jthread> threads;
+  threads.reserve(num_tasks - 1);
+  for (size_t i = 1; i < num_tasks; i++) {
+    threads.emplace_back(task, i);
+  }
+  task(0);
+};
+
+}  // namespace detail
+
+// Computes the same check value as |CrcType::Compute(data, length)| by splitting the message into
+// up to |num_chunks| chunks, computing the CRC of each chunk as a task run by |executor|, then
+// combining the chunks' check values with |CrcType::Combine|. |CrcType| is a Crc instantiation,
+// e.g. Crc<Crc32IsoHdlc>.
+//
+// |executor| is invoked once as |executor(num_tasks, task)| and must call |task(i)| exactly once
+// for each i in [0, num_tasks), in any order and on any threads, returning only after all calls
+// have completed. This allows use of an existing thread pool.
+//
+// Chunks are no shorter than |kMinChunkLength| octets (except the last), so short messages may use
+// fewer tasks than |num_chunks|.
+//
+// Example:
+//   auto run_tasks = [&pool](size_t num_tasks, auto task) {
+//     pool.ParallelFor(0, num_tasks, task);
+//   };
+//   auto check_value = ComputeCrcParallel<Crc<Crc32IsoHdlc>>(data, size, 32, run_tasks);
+template <typename CrcType, typename Octet, typename Executor>
+[[nodiscard]] typename CrcType::RegisterType ComputeCrcParallel(const Octet* data,
+                                                               size_t length,
+                                                               size_t num_chunks,
+                                                               Executor&& executor) {
+  using RegisterType = typename CrcType::RegisterType;
+
+  // Short enough that each core has enough work for splitting to pay off for large messages, but
+  // long enough that the per-chunk overhead (including combining) is insignificant.
+  constexpr size_t kMinChunkLength = size_t{1} << 16;
+  MAYS_CHECK(num_chunks > 0);
+
+  // Round the chunk length up to a multiple of cache line size so that chunks don't share lines.
+  constexpr size_t kChunkAlignment = 64;
+  size_t chunk_length = (length + num_chunks - 1) / num_chunks;
+  chunk_length = (chunk_length + kChunkAlignment - 1) / kChunkAlignment * kChunkAlignment;
+  if (chunk_length < kMinChunkLength) {
+    chunk_length = kMinChunkLength;
+  }
+  if (length <= chunk_length) {
+    return CrcType::Compute(data, length);
+  }
+  num_chunks = (length + chunk_length - 1) / chunk_length;
+
+  std::vector<RegisterType> check_values(num_chunks);
+  executor(num_chunks, [&](size_t chunk_index) {
+    const size_t offset = chunk_index * chunk_length;
+    const size_t this_chunk_length = std::min(chunk_length, length - offset);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    check_values[chunk_index] = CrcType::Compute(data + offset, this_chunk_length);
+  });
+
+  RegisterType check_value = check_values.front();
+  for (size_t chunk_index = 1; chunk_index < num_chunks; chunk_index++) {
+    const size_t this_chunk_length = std::min(chunk_length, length - chunk_index * chunk_length);
+    check_value = CrcType::Combine(check_value, check_values[chunk_index], this_chunk_length);
+  }
+  return check_value;
+}
+
+// Computes the same check value as |CrcType::Compute(data, length)| using up to |num_threads|
+// threads, including the calling thread. See the overload above taking an executor.
+//
+// Example:
+//   auto check_value = ComputeCrcParallel<Crc<Crc32IsoHdlc>>(
+//       data, size, std::thread::hardware_concurrency());
+template <typename CrcType, typename Octet>
+[[nodiscard]] typename CrcType::RegisterType ComputeCrcParallel(const Octet* data,
+                                                               size_t length,
+                                                               size_t num_threads) {
+  return ComputeCrcParallel<CrcType>(data, length, num_threads, detail::kRunCrcTasksOnThreads);
+}
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_PARALLEL_H
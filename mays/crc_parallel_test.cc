@@ -0,0 +1,76 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "crc_parallel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_test_util.h"
+
+namespace mays {
+namespace {
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs in parallel is same as serially",
+                   "[crc_parallel]",
+                   Crc15Can,
+                   Crc24Ble,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Ecma182) {
+  // Long enough to be split into several chunks, with a partial chunk at the end.
+  const std::vector<uint8_t> message = MakeMessage((size_t{1} << 20) + 3);
+  const auto expected = Crc<TestType>::Compute(message.data(), message.size());
+  for (const size_t num_threads : {1, 2, 3, 8, 1000}) {
+    CAPTURE(num_threads);
+    CHECK(expected ==
+          ComputeCrcParallel<Crc<TestType>>(message.data(), message.size(), num_threads));
+  }
+}
+
+TEST_CASE("Compute CRCs in parallel using an executor", "[crc_parallel]") {
+  const std::vector<uint8_t> message = MakeMessage(size_t{1} << 20);
+  size_t num_tasks_run = 0;
+  auto run_in_reverse = [&num_tasks_run](size_t num_tasks, auto task) {
+    for (size_t i = num_tasks; i-- > 0;) {
+      task(i);
+      num_tasks_run++;
+    }
+  };
+  CHECK(Crc<Crc32IsoHdlc>::Compute(message.data(), message.size()) ==
+        ComputeCrcParallel<Crc<Crc32IsoHdlc>>(message.data(), message.size(), 4, run_in_reverse));
+  CHECK(4 == num_tasks_run);
+}
+
+TEST_CASE("Run CRC tasks on threads when the calling thread's task throws", "[crc_parallel]") {
+  std::atomic<size_t> num_tasks_run = 0;
+  CHECK_THROWS_AS(detail::kRunCrcTasksOnThreads(4,
+                                                [&num_tasks_run](size_t task_index) {
+                                                  if (task_index == 0) {
+                                                    throw std::runtime_error("task 0");
+                                                  }
+                                                  num_tasks_run++;
+                                                }),
+                  std::runtime_error);
+  CHECK(3 == num_tasks_run);
+}
+
+TEST_CASE("Compute CRCs in parallel over short messages", "[crc_parallel]") {
+  const std::vector<uint8_t> message = MakeMessage(100);
+  for (const size_t length : {0, 1, 100}) {
+    CAPTURE(length);
+    CHECK(Crc<Crc32IsoHdlc>::Compute(message.data(), length) ==
+          ComputeCrcParallel<Crc<Crc32IsoHdlc>>(message.data(), length, 8));
+  }
+}
+
+}  // namespace
+}  // namespace mays
@@ -0,0 +1,204 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_RECORD_LOG_H
+#define MAYS_CRC_RECORD_LOG_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "crc.h"
+#include "crc_parallel.h"
+#include "internal/check.h"
+
+namespace mays {
+
+// Reason that reading a record log stopped.
+enum class CrcRecordLogStatus {
+  // Every record in the log was verified.
+  kComplete,
+  // The last record extends past the end of the log, e.g. because writing it was interrupted.
+  kTornRecord,
+  // A record's payload does not match its check value.
+  kCorruptRecord,
+};
+
+// Result of reading a record log.
+struct CrcRecordLogResult {
+  CrcRecordLogStatus status;
+  // Number of verified records, all of which were visited.
+  size_t num_records;
+  // Length in octets of the verified records at the start of the log, i.e. the offset of the
+  // record that stopped reading (if any). Appending may resume at this offset.
+  size_t valid_length;
+};
+
+namespace detail {
+
+// Octets of payload verified by each task at most, which bounds how far verification runs ahead of
+// the visitor. Windows of records are verified by up to |num_tasks| tasks at a time.
+inline constexpr size_t kCrcRecordLogMaxBatchLength = size_t{1} << 22;
+
+// Octets of payload verified by each task at least, so that short logs don't pay for many tasks.
+inline constexpr size_t kCrcRecordLogMinBatchLength = size_t{1} << 16;
+
+template <typename Octet>
+[[nodiscard]] uint64_t LoadLittleEndian(const Octet* data, size_t length) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < length; i++) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    value |= uint64_t{static_cast<uint8_t>(data[i])} << (8 * i);
+  }
+  return value;
+}
+
+}  // namespace detail
+
+// Reads a log of CRC-framed records in |data|, calling |visitor| in order with a std::span view of
+// each record's payload after verifying it, and stopping at the first record that is torn or
+// corrupt. |CrcType| is a Crc instantiation, e.g. Crc<Crc32IsoHdlc>. Payloads are not copied.
+//
+// Each record is laid out as:
+//   - Length of the payload in octets, as a 32-bit little-endian integer.
+//   - Payload.
+//   - Check value of the payload, little-endian in |CrcType::kCheckValueLength| octets.
+//
+// Records are verified in windows of up to |num_tasks| contiguous batches, each batch as a task run
+// by |executor|, so that verification is parallel while records are still visited in log order.
+// Within each window, the headers are scanned serially and records after the first corrupt one are
+// never visited. |executor| has the same requirements as for ComputeCrcParallel.
+//
+// Example:
+//   auto result = ReadCrcRecordLog<Crc<Crc32IsoHdlc>>(
+//       mapping, size, [&](std::span<const uint8_t> payload) { Replay(payload); }, 32, run_tasks);
+//   if (result.status != CrcRecordLogStatus::kComplete) {
+//     Truncate(result.valid_length);
+//   }
+template <typename CrcType, typename Octet, typename Visitor, typename Executor>
+CrcRecordLogResult ReadCrcRecordLog(const Octet* data,
+                                    size_t length,
+                                    Visitor&& visitor,
+                                    size_t num_tasks,
+                                    Executor&& executor) {
+  static_assert(sizeof(Octet) == sizeof(uint8_t));
+  constexpr size_t kLengthFieldLength = sizeof(uint32_t);
+  constexpr size_t kCheckValueLength = CrcType::kCheckValueLength;
+  MAYS_CHECK(num_tasks > 0);
+
+  struct Record {
+    size_t payload_offset;
+    size_t payload_length;
+  };
+  std::vector<Record> records;
+  // Index of the first record of each batch in |records|, followed by the number of records.
+  std::vector<size_t> batch_starts;
+  std::vector<size_t> first_failures;
+  CrcRecordLogResult result = {CrcRecordLogStatus::kComplete, 0, 0};
+  while (result.valid_length < length) {
+    // Scan the headers of a window of records.
+    records.clear();
+    bool torn = false;
+    size_t window_payload_length = 0;
+    const size_t max_window_payload_length = num_tasks * detail::kCrcRecordLogMaxBatchLength;
+    for (size_t offset = result.valid_length;
+         offset < length && window_payload_length < max_window_payload_length;) {
+      if (length - offset < kLengthFieldLength) {
+        torn = true;
+        break;
+      }
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto payload_length = detail::LoadLittleEndian(data + offset, kLengthFieldLength);
+      const size_t remaining_length = length - offset - kLengthFieldLength;
+      if (remaining_length < kCheckValueLength ||
+          payload_length > remaining_length - kCheckValueLength) {
+        torn = true;
+        break;
+      }
+      records.push_back({offset + kLengthFieldLength, static_cast<size_t>(payload_length)});
+      window_payload_length += static_cast<size_t>(payload_length);
+      offset += kLengthFieldLength + static_cast<size_t>(payload_length) + kCheckValueLength;
+    }
+
+    // Split the window into batches of about the same payload length.
+    const size_t batch_length =
+        std::max(window_payload_length / num_tasks, detail::kCrcRecordLogMinBatchLength);
+    batch_starts.assign(1, 0);
+    size_t this_batch_length = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+      if (this_batch_length >= batch_length) {
+        batch_starts.push_back(i);
+        this_batch_length = 0;
+      }
+      this_batch_length += records[i].payload_length;
+    }
+    batch_starts.push_back(records.size());
+
+    // Each batch finds the index of its first corrupt record, or the index past its last record.
+    const size_t num_batches = batch_starts.size() - 1;
+    first_failures.assign(num_batches, 0);
+    auto verify_batch = [&](size_t batch_index) {
+      size_t i = batch_starts[batch_index];
+      for (; i < batch_starts[batch_index + 1]; i++) {
+        const Record& record = records[i];
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto check_value = detail::LoadLittleEndian(
+            data + record.payload_offset + record.payload_length, kCheckValueLength);
+        if (CrcType::Compute(data + record.payload_offset, record.payload_length) != check_value) {
+          break;
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+      first_failures[batch_index] = i;
+    };
+    if (num_batches > 1) {
+      executor(num_batches, verify_batch);
+    } else if (num_batches == 1) {
+      verify_batch(0);
+    }
+
+    // Visit records in order up to the first corrupt one.
+    for (size_t batch_index = 0; batch_index < num_batches; batch_index++) {
+      const size_t num_verified = first_failures[batch_index];
+      for (size_t i = batch_starts[batch_index]; i < num_verified; i++) {
+        const Record& record = records[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        visitor(std::span<const Octet>(data + record.payload_offset, record.payload_length));
+        result.num_records++;
+        result.valid_length = record.payload_offset + record.payload_length + kCheckValueLength;
+      }
+      if (num_verified < batch_starts[batch_index + 1]) {
+        result.status = CrcRecordLogStatus::kCorruptRecord;
+        return result;
+      }
+    }
+    if (torn) {
+      result.status = CrcRecordLogStatus::kTornRecord;
+      return result;
+    }
+  }
+  return result;
+}
+
+// Reads a log of CRC-framed records using up to |num_threads| threads, including the calling
+// thread. See the overload above taking an executor.
+//
+// Example:
+//   auto result = ReadCrcRecordLog<Crc<Crc32IsoHdlc>>(
+//       mapping, size, [&](std::span<const uint8_t> payload) { Replay(payload); },
+//       std::thread::hardware_concurrency());
+template <typename CrcType, typename Octet, typename Visitor>
+CrcRecordLogResult ReadCrcRecordLog(const Octet* data,
+                                    size_t length,
+                                    Visitor&& visitor,
+                                    size_t num_threads) {
+  return ReadCrcRecordLog<CrcType>(
+      data, length, visitor, num_threads, detail::kRunCrcTasksOnThreads);
+}
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_RECORD_LOG_H
@@ -0,0 +1,141 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "crc_record_log.h"
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+
+namespace mays {
+namespace {
+
+// Log of records with payloads of the given lengths, and the offset of each record.
+template <typename CrcType>
+struct TestLog {
+  explicit TestLog(const std::vector<size_t>& payload_lengths) {
+    for (size_t i = 0; i < payload_lengths.size(); i++) {
+      offsets.push_back(octets.size());
+      std::vector<uint8_t> payload(payload_lengths[i]);
+      for (size_t j = 0; j < payload.size(); j++) {
+        payload[j] = static_cast<uint8_t>((i * 0x9e + j * 0x37) ^ (j >> 8));  // NOLINT
+      }
+      for (size_t j = 0; j < sizeof(uint32_t); j++) {
+        octets.push_back(static_cast<uint8_t>(payload.size() >> (8 * j)));
+      }
+      octets.insert(octets.end(), payload.begin(), payload.end());
+      const uint64_t check_value = CrcType::Compute(payload.data(), payload.size());
+      for (size_t j = 0; j < CrcType::kCheckValueLength; j++) {
+        octets.push_back(static_cast<uint8_t>(check_value >> (8 * j)));
+      }
+      payloads.push_back(std::move(payload));
+    }
+  }
+
+  std::vector<uint8_t> octets;
+  std::vector<size_t> offsets;
+  std::vector<std::vector<uint8_t>> payloads;
+};
+
+// Reads |length| octets of |log|, checking that the payloads visited are its first ones in order.
+template <typename CrcType>
+CrcRecordLogResult ReadTestLog(const TestLog<CrcType>& log, size_t length, size_t num_threads) {
+  size_t num_visited = 0;
+  const auto result = ReadCrcRecordLog<CrcType>(
+      log.octets.data(),
+      length,
+      [&](std::span<const uint8_t> payload) {
+        REQUIRE(num_visited < log.payloads.size());
+        CHECK(log.payloads[num_visited] == std::vector<uint8_t>(payload.begin(), payload.end()));
+        // Payloads are views into the log.
+        CHECK(&log.octets[log.offsets[num_visited] + sizeof(uint32_t)] == payload.data());
+        num_visited++;
+      },
+      num_threads);
+  CHECK(result.num_records == num_visited);
+  return result;
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Read record logs", "[crc_record_log]", Crc16Arc, Crc32IsoHdlc, Crc64Xz) {
+  using CrcType = Crc<TestType>;
+  // Enough large records to be split into several windows of batches, with an empty payload.
+  std::vector<size_t> payload_lengths = {0, 1, 100};
+  for (size_t i = 0; i < 40; i++) {
+    payload_lengths.push_back(((size_t{1} << 18) + 7) * ((i + 1) % 3));
+  }
+  const TestLog<CrcType> log(payload_lengths);
+
+  for (const size_t num_threads : {1, 2, 8}) {
+    CAPTURE(num_threads);
+    SECTION("Complete") {
+      const auto result = ReadTestLog(log, log.octets.size(), num_threads);
+      CHECK(CrcRecordLogStatus::kComplete == result.status);
+      CHECK(payload_lengths.size() == result.num_records);
+      CHECK(log.octets.size() == result.valid_length);
+    }
+
+    SECTION("Torn") {
+      for (const size_t torn_length : {size_t{1}, size_t{4}, size_t{5}, size_t{12}}) {
+        CAPTURE(torn_length);
+        const auto result = ReadTestLog(log, log.offsets.back() + torn_length, num_threads);
+        CHECK(CrcRecordLogStatus::kTornRecord == result.status);
+        CHECK(payload_lengths.size() - 1 == result.num_records);
+        CHECK(log.offsets.back() == result.valid_length);
+      }
+    }
+
+    SECTION("Corrupt") {
+      for (const size_t corrupt_record : {size_t{1}, size_t{20}, payload_lengths.size() - 1}) {
+        CAPTURE(corrupt_record);
+        TestLog<CrcType> corrupt_log = log;
+        corrupt_log.octets[corrupt_log.offsets[corrupt_record] + sizeof(uint32_t)] ^= 0x10;
+        const auto result = ReadTestLog(corrupt_log, corrupt_log.octets.size(), num_threads);
+        CHECK(CrcRecordLogStatus::kCorruptRecord == result.status);
+        CHECK(corrupt_record == result.num_records);
+        CHECK(log.offsets[corrupt_record] == result.valid_length);
+      }
+    }
+  }
+}
+
+TEST_CASE("Read empty record log", "[crc_record_log]") {
+  const auto result = ReadCrcRecordLog<Crc<Crc32IsoHdlc>>(
+      static_cast<const uint8_t*>(nullptr), 0, [](std::span<const uint8_t>) { FAIL(); }, 4);
+  CHECK(CrcRecordLogStatus::kComplete == result.status);
+  CHECK(0 == result.num_records);
+  CHECK(0 == result.valid_length);
+}
+
+TEST_CASE("Read record log using an executor", "[crc_record_log]") {
+  const TestLog<Crc<Crc32Iscsi>> log(std::vector<size_t>(8, size_t{1} << 17));
+  size_t num_tasks_run = 0;
+  auto run_in_reverse = [&num_tasks_run](size_t num_tasks, auto task) {
+    for (size_t i = num_tasks; i-- > 0;) {
+      task(i);
+      num_tasks_run++;
+    }
+  };
+  size_t num_visited = 0;
+  const auto result = ReadCrcRecordLog<Crc<Crc32Iscsi>>(
+      log.octets.data(),
+      log.octets.size(),
+      [&](std::span<const uint8_t> payload) {
+        CHECK(log.payloads[num_visited++].size() == payload.size());
+      },
+      4,
+      run_in_reverse);
+  CHECK(CrcRecordLogStatus::kComplete == result.status);
+  CHECK(8 == result.num_records);
+  CHECK(4 == num_tasks_run);
+}
+
+}  // namespace
+}  // namespace mays
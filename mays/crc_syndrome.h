@@ -0,0 +1,202 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_SYNDROME_H
+#define MAYS_CRC_SYNDROME_H
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "crc.h"
+#include "internal/check.h"
+
+namespace mays {
+namespace detail {
+
+// Open-addressed hash table from the syndrome of each single-bit error to its position, generated
+// by |GenerateCrcSyndromeTable|.
+template <typename RegisterType, size_t Size>
+struct CrcSyndromeHashTable {
+  struct Entry {
+    // Zero for empty slots, which no single-bit error produces.
+    RegisterType syndrome;
+    // Bit index into the check value if less than the polynomial width, or otherwise that width
+    // plus the number of message bits after the erroneous one.
+    uint32_t position;
+  };
+
+  std::array<Entry, Size> entries;
+  // Longest run of slots probed to find any entry.
+  size_t max_probe_count;
+  // False if two single-bit errors produce the same syndrome, i.e. the table is unusable.
+  bool distinct;
+};
+
+// Returns the slot of |syndrome| in a table of 2^|Log2Size| slots before probing.
+template <size_t Log2Size, typename RegisterType>
+[[nodiscard]] constexpr size_t GetCrcSyndromeSlot(RegisterType syndrome) {
+  // Fibonacci hashing spreads syndromes that differ only in their high bits.
+  // NOLINTNEXTLINE(readability-magic-numbers)
+  return static_cast<size_t>((uint64_t{syndrome} * 0x9e37'79b9'7f4a'7c15) >> (64 - Log2Size));
+}
+
+template <typename Traits, size_t Log2Size, size_t PositionCount>
+[[nodiscard]] constexpr auto GenerateCrcSyndromeTable() {
+  using RegisterType = typename Traits::RegisterType;
+  constexpr size_t kPolynomialBitWidth = Traits::kPolynomialBitWidth;
+  constexpr auto kPolynomialMask = MaskLowBits<RegisterType, kPolynomialBitWidth>();
+  constexpr size_t kSize = size_t{1} << Log2Size;
+
+  CrcSyndromeHashTable<RegisterType, kSize> table{};
+  table.distinct = true;
+  auto insert = [&table](RegisterType syndrome, size_t position) {
+    size_t probe_count = 1;
+    for (size_t slot = GetCrcSyndromeSlot<Log2Size>(syndrome); table.entries[slot].syndrome != 0;
+         slot = (slot + 1) % kSize, probe_count++) {
+      table.distinct = table.distinct && table.entries[slot].syndrome != syndrome;
+    }
+    const size_t slot = (GetCrcSyndromeSlot<Log2Size>(syndrome) + probe_count - 1) % kSize;
+    table.entries[slot] = {syndrome, static_cast<uint32_t>(position)};
+    table.max_probe_count =
+        probe_count > table.max_probe_count ? probe_count : table.max_probe_count;
+  };
+
+  // An error in bit k of the check value is its own syndrome.
+  for (size_t k = 0; k < kPolynomialBitWidth; k++) {
+    insert(static_cast<RegisterType>(RegisterType{1} << k), k);
+  }
+
+  // An error in the message bit followed by d more message bits has the syndrome x^(d + width) mod
+  // the generator polynomial, starting from x^width mod the generator polynomial for the last bit.
+  // These are written higher-power-left, and check values are in the orientation of the remainder.
+  RegisterType syndrome = Traits::kPolynomial;
+  for (size_t position = kPolynomialBitWidth; position < PositionCount; position++) {
+    if constexpr (Traits::kReflect) {
+      insert(ReflectBits<RegisterType, kPolynomialBitWidth>(syndrome), position);
+    } else {
+      insert(syndrome, position);
+    }
+    const bool subtract = ((syndrome >> (kPolynomialBitWidth - 1)) & 0b1) != 0;
+    syndrome = static_cast<RegisterType>((syndrome << 1) & kPolynomialMask);
+    syndrome = subtract ? static_cast<RegisterType>(syndrome ^ Traits::kPolynomial) : syndrome;
+  }
+  return table;
+}
+
+}  // namespace detail
+
+// Locates and corrects single-bit errors in frames of up to |MaxLength| octets of message followed
+// by their check value, using a table generated at compile time that maps each single-bit error's
+// syndrome (the received check value XOR the check value computed from the received message) to
+// the error's position. This replaces flipping each bit of the frame in turn and recomputing its
+// CRC with one CRC computation and an O(1) look-up.
+//
+// Bit indices count bits of the message from 0 as bit |index % 8| (with 0 as the LSb) of octet
+// |index / 8|, followed by the bits of the check value as bit |index - 8 * length| of the check
+// value, regardless of the order in which the CRC processes bits.
+//
+// Correcting errors uses up some of the CRC's power to detect errors: a frame with several errors
+// may have the same syndrome as a single-bit error and be "corrected" into a wrong frame. This
+// should only be used for channels with mostly isolated bit errors, or where a stronger check
+// follows. |MaxLength| must be short enough for every single-bit error to have a distinct
+// syndrome, which is checked at compile time.
+//
+// Example:
+//   using Syndromes = CrcSyndromeTable<Crc24Ble, 255>;
+//   if (Crc<Crc24Ble>::Compute(pdu, length) != received_crc) {
+//     if (!Syndromes::Correct(pdu, length, received_crc)) {
+//       DropPdu();
+//     }
+//   }
+template <typename Traits, size_t MaxLength>
+class CrcSyndromeTable {
+ public:
+  using RegisterType = typename Traits::RegisterType;
+
+  // Returns the bit index of the single-bit error that produces |syndrome| in a frame of |length|
+  // octets of message, or std::nullopt if no single-bit error does (including if |syndrome| is
+  // zero, i.e. there is no error).
+  [[nodiscard]] static constexpr std::optional<size_t> Locate(RegisterType syndrome,
+                                                              size_t length) {
+    MAYS_CHECK(length <= MaxLength);
+    if (syndrome == 0) {
+      return std::nullopt;
+    }
+    size_t slot = detail::GetCrcSyndromeSlot<kLog2Size>(syndrome);
+    for (size_t i = 0; i < kTable.max_probe_count; i++) {
+      const auto& entry = kTable.entries[slot];
+      if (entry.syndrome == 0) {
+        break;
+      }
+      if (entry.syndrome != syndrome) {
+        slot = (slot + 1) % kTable.entries.size();
+        continue;
+      }
+      if (entry.position < kPolynomialBitWidth) {
+        return 8 * length + entry.position;
+      }
+      // Errors further from the end than the length of the message are outside of the frame.
+      const size_t bits_after = entry.position - kPolynomialBitWidth;
+      if (bits_after >= 8 * length) {
+        break;
+      }
+      // Convert from the order that the CRC processes message bits to the order of bit indices.
+      const size_t processing_index = 8 * length - 1 - bits_after;
+      return Traits::kReflect ? processing_index
+                              : (processing_index | 0b111) - processing_index % 8;
+    }
+    return std::nullopt;
+  }
+
+  // Corrects a single-bit error in a frame with |length| octets of message at |data| and the check
+  // value |check_value| received with it, returning the bit index of the corrected bit. Returns
+  // std::nullopt without modifying the frame if it has no error or the error is not correctable.
+  template <typename Octet>
+  static constexpr std::optional<size_t> Correct(Octet* data,
+                                                 size_t length,
+                                                 RegisterType& check_value) {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+    const auto index = Locate(
+        static_cast<RegisterType>(check_value ^ Crc<Traits>::Compute(data, length)), length);
+    if (!index.has_value()) {
+      return std::nullopt;
+    }
+    if (*index < 8 * length) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data[*index / 8] = static_cast<Octet>(data[*index / 8] ^ (1U << (*index % 8)));
+    } else {
+      const size_t check_value_index = *index - 8 * length;
+      check_value = static_cast<RegisterType>(check_value ^ (RegisterType{1} << check_value_index));
+    }
+    return index;
+  }
+
+ private:
+  static constexpr size_t kPolynomialBitWidth = Traits::kPolynomialBitWidth;
+
+  // Every bit of the longest frame, including its check value.
+  static constexpr size_t kPositionCount = 8 * MaxLength + kPolynomialBitWidth;
+  static_assert(kPositionCount <= uint32_t{0xffff'ffff});
+
+  // Table with at least twice as many slots as positions keeps probe runs short.
+  static constexpr size_t kLog2Size = [] {
+    size_t log2_size = 1;
+    while ((size_t{1} << log2_size) < 2 * kPositionCount) {
+      log2_size++;
+    }
+    return log2_size;
+  }();
+
+  static constexpr auto kTable =
+      detail::GenerateCrcSyndromeTable<Traits, kLog2Size, kPositionCount>();
+  static_assert(kTable.distinct,
+                "MaxLength is too long for every single-bit error to have a distinct syndrome");
+};
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_SYNDROME_H
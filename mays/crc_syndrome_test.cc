@@ -0,0 +1,94 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "crc_syndrome.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_test_util.h"
+
+namespace mays {
+namespace {
+
+// Checks that |SyndromeTable| corrects every single-bit error in frames with messages of several
+// lengths up to |max_length| octets.
+template <typename Traits, typename SyndromeTable>
+void CheckCorrectsEverySingleBitError(size_t max_length) {
+  std::vector<uint8_t> message = MakeMessage(max_length);
+  for (const size_t length : {size_t{0}, size_t{1}, size_t{3}, max_length}) {
+    CAPTURE(length);
+    const auto check_value = Crc<Traits>::Compute(message.data(), length);
+    // Frames without errors are left alone.
+    auto received_check_value = check_value;
+    CHECK(std::nullopt == SyndromeTable::Correct(message.data(), length, received_check_value));
+    CHECK(check_value == received_check_value);
+
+    for (size_t index = 0; index < 8 * length + Traits::kPolynomialBitWidth; index++) {
+      CAPTURE(index);
+      std::vector<uint8_t> received = message;
+      received_check_value = check_value;
+      if (index < 8 * length) {
+        received[index / 8] ^= static_cast<uint8_t>(1U << (index % 8));
+      } else {
+        received_check_value ^= static_cast<decltype(check_value)>(
+            decltype(check_value){1} << (index - 8 * length));
+      }
+      REQUIRE(index == SyndromeTable::Correct(received.data(), length, received_check_value));
+      CHECK(message == received);
+      CHECK(check_value == received_check_value);
+    }
+  }
+}
+
+TEST_CASE("Correct single-bit errors in frames", "[crc_syndrome]") {
+  CheckCorrectsEverySingleBitError<Crc8Bluetooth, CrcSyndromeTable<Crc8Bluetooth, 4>>(4);
+  CheckCorrectsEverySingleBitError<Crc15Can, CrcSyndromeTable<Crc15Can, 8>>(8);
+  CheckCorrectsEverySingleBitError<Crc16Xmodem, CrcSyndromeTable<Crc16Xmodem, 64>>(64);
+  CheckCorrectsEverySingleBitError<Crc24Ble, CrcSyndromeTable<Crc24Ble, 257>>(257);
+  CheckCorrectsEverySingleBitError<Crc32IsoHdlc, CrcSyndromeTable<Crc32IsoHdlc, 100>>(100);
+}
+
+TEST_CASE("Locate single-bit errors at compile time", "[crc_syndrome]") {
+  using SyndromeTable = CrcSyndromeTable<Crc15Can, 8>;
+  static constexpr std::array<uint8_t, 8> kMessage = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc};
+  constexpr auto kCheckValue = Crc<Crc15Can>::Compute(kMessage.data(), kMessage.size());
+  constexpr auto kSyndromeOf = [](size_t index) {
+    auto received = kMessage;
+    received[index / 8] ^= static_cast<uint8_t>(1U << (index % 8));
+    return static_cast<uint16_t>(kCheckValue ^
+                                 Crc<Crc15Can>::Compute(received.data(), received.size()));
+  };
+  static_assert(SyndromeTable::Locate(kSyndromeOf(0), 8) == 0);
+  static_assert(SyndromeTable::Locate(kSyndromeOf(13), 8) == 13);
+  static_assert(SyndromeTable::Locate(kSyndromeOf(63), 8) == 63);
+  static_assert(SyndromeTable::Locate(0b100, 8) == 8 * 8 + 2);
+
+  // Errors that would be before the start of shorter messages are not correctable.
+  CHECK(std::nullopt == SyndromeTable::Locate(kSyndromeOf(0), 7));
+  CHECK(std::nullopt == SyndromeTable::Locate(0, 8));
+}
+
+TEST_CASE("Do not correct some multiple-bit errors in frames", "[crc_syndrome]") {
+  // Flipping two bits usually results in a syndrome that no single-bit error produces.
+  std::array<uint8_t, 32> message{};
+  const auto check_value = Crc<Crc24Ble>::Compute(message.data(), message.size());
+  message[3] ^= 0b1001;
+  auto received_check_value = check_value;
+  const auto received = message;
+  CHECK(std::nullopt ==
+        CrcSyndromeTable<Crc24Ble, 255>::Correct(message.data(), message.size(),
+                                                 received_check_value));
+  CHECK(received == message);
+  CHECK(check_value == received_check_value);
+}
+
+}  // namespace
+}  // namespace mays
@@ -4,11 +4,21 @@
 
 #include "crc.h"
 
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <array>
+#include <span>
 #include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "crc_test_util.h"
+
 namespace mays {
 namespace {
 
@@ -29,6 +39,7 @@ TEST_CASE("Compute CRCs against their catalog \"check\" values", "[crc]") {
   CHECK(0x21cf02 == compute_crc(Crc<Crc24Openpgp>()));
   CHECK(0xfc891918 == compute_crc(Crc<Crc32Bzip2>()));
   CHECK(0xcbf43926 == compute_crc(Crc<Crc32IsoHdlc>()));
+  CHECK(0xe3069283 == compute_crc(Crc<Crc32Iscsi>()));
   CHECK(0x6c40df5f0b497347 == compute_crc(Crc<Crc64Ecma182>()));
   CHECK(0x995dc9bbdf1939fa == compute_crc(Crc<Crc64Xz>()));
 }
@@ -45,22 +56,7 @@ TEST_CASE("Compute CRCs with an explicit initial value", "[crc]") {
 }
 
 // NOLINTNEXTLINE
-TEMPLATE_TEST_CASE("Compute CRCs in parts is same as in one step",
-                   "[crc]",
-                   Crc6Darc,
-                   Crc7Mmc,
-                   Crc8Bluetooth,
-                   Crc15Can,
-                   Crc16Arc,
-                   Crc16Xmodem,
-                   Crc17CanFd,
-                   Crc21CanFd,
-                   Crc24Ble,
-                   Crc24Openpgp,
-                   Crc32Bzip2,
-                   Crc32IsoHdlc,
-                   Crc64Ecma182,
-                   Crc64Xz) {
+TEMPLATE_LIST_TEST_CASE("Compute CRCs in parts is same as in one step", "[crc]", CrcCatalogModels) {
   constexpr std::string_view kTestString = "123456789";
   constexpr auto compute_crc = [kTestString] {
     return Crc<TestType>::Compute(kTestString.data(), kTestString.size());
@@ -90,6 +86,523 @@ TEMPLATE_TEST_CASE("Compute CRCs in parts is same as in one step",
   }
 }
 
+// NOLINTNEXTLINE
+TEMPLATE_LIST_TEST_CASE("Compute CRCs with each table policy is same as one octet at a time",
+                        "[crc]",
+                        CrcCatalogModels) {
+  // Arbitrary message long enough to have multiple slices and a partial slice.
+  constexpr auto kMessage = MakeMessage<53>();
+  using BitwiseCrc = Crc<TestType, CrcTablePolicy::kBitwise>;
+  using NibbleCrc = Crc<TestType, CrcTablePolicy::kNibble>;
+  using OctetCrc = Crc<TestType, CrcTablePolicy::kOctet>;
+  using SliceBy8Crc = Crc<TestType, CrcTablePolicy::kSliceBy8>;
+  using SliceBy16Crc = Crc<TestType, CrcTablePolicy::kSliceBy16>;
+  using LazyNibbleCrc = Crc<TestType, CrcTablePolicy::kNibble, CrcTableInit::kOnFirstUse>;
+  using LazyOctetCrc = Crc<TestType, CrcTablePolicy::kOctet, CrcTableInit::kOnFirstUse>;
+  using LazySliceBy16Crc = Crc<TestType, CrcTablePolicy::kSliceBy16, CrcTableInit::kOnFirstUse>;
+  static_assert(OctetCrc::Compute(kMessage.data(), kMessage.size()) ==
+                SliceBy16Crc::Compute(kMessage.data(), kMessage.size()));
+  static_assert(OctetCrc::Compute(kMessage.data(), kMessage.size()) ==
+                NibbleCrc::Compute(kMessage.data(), kMessage.size()));
+  static_assert(OctetCrc::Compute(kMessage.data(), kMessage.size()) ==
+                LazySliceBy16Crc::Compute(kMessage.data(), kMessage.size()));
+
+  for (size_t length = 0; length <= kMessage.size(); length++) {
+    CAPTURE(length);
+    const auto expected = OctetCrc::Compute(kMessage.data(), length);
+    CHECK(expected == BitwiseCrc::Compute(kMessage.data(), length));
+    CHECK(expected == NibbleCrc::Compute(kMessage.data(), length));
+    CHECK(expected == SliceBy8Crc::Compute(kMessage.data(), length));
+    CHECK(expected == SliceBy16Crc::Compute(kMessage.data(), length));
+    CHECK(expected == LazyNibbleCrc::Compute(kMessage.data(), length));
+    CHECK(expected == LazyOctetCrc::Compute(kMessage.data(), length));
+    CHECK(expected == LazySliceBy16Crc::Compute(kMessage.data(), length));
+  }
+
+  SECTION("Remainder carries between sliced and bit-oriented data") {
+    OctetCrc octet_crc;
+    SliceBy8Crc sliced_crc;
+    octet_crc.template AppendBits<3>(0b101);
+    sliced_crc.template AppendBits<3>(0b101);
+    octet_crc.AppendOctets(kMessage.data(), kMessage.size());
+    sliced_crc.AppendOctets(kMessage.data(), kMessage.size());
+    CHECK(octet_crc.GetCheckValue() == sliced_crc.GetCheckValue());
+  }
+}
+
+TEST_CASE("Compute CRCs with tables generated on first use concurrently", "[crc]") {
+  // A model whose tables no other test generates at run time.
+  using LazyCrc = Crc<Crc24Openpgp, CrcTablePolicy::kSliceBy8, CrcTableInit::kOnFirstUse>;
+  constexpr std::string_view kMessage = "The quick brown fox jumps over the lazy dog";
+  std::vector<uint32_t> check_values(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < check_values.size(); i++) {
+    threads.emplace_back(
+        [&, i] { check_values[i] = LazyCrc::Compute(kMessage.data(), kMessage.size()); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const uint32_t check_value : check_values) {
+    CHECK(Crc<Crc24Openpgp>::Compute(kMessage.data(), kMessage.size()) == check_value);
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_LIST_TEST_CASE("Compute CRCs over long messages is same as one octet at a time",
+                        "[crc]",
+                        CrcCatalogModels) {
+  // Long enough for any accelerated code paths (e.g. carry-less multiplication) to engage, with
+  // lengths and offsets that exercise each of their partial-block cases.
+  const auto message = MakeMessage<1000>();
+  for (const size_t offset : {0, 1, 7}) {
+    for (const size_t length : {127, 128, 129, 143, 144, 191, 192, 255, 256, 333, 992}) {
+      CAPTURE(offset, length);
+      Crc<TestType> crc_by_octet;
+      for (size_t i = offset; i < offset + length; i++) {
+        crc_by_octet.AppendOctets(&message.at(i), 1);
+      }
+      CHECK(crc_by_octet.GetCheckValue() ==
+            Crc<TestType>::Compute(&message.at(offset), length));
+      CHECK(crc_by_octet.GetCheckValue() ==
+            Crc<TestType, CrcTablePolicy::kSliceBy16>::Compute(&message.at(offset), length));
+    }
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_LIST_TEST_CASE("Combine CRCs of consecutive messages", "[crc]", CrcCatalogModels) {
+  constexpr std::string_view kTestString = "123456789";
+  constexpr std::string_view kTestStringA = kTestString.substr(0, 4);
+  constexpr std::string_view kTestStringB = kTestString.substr(4);
+  static_assert(Crc<TestType>::Compute(kTestString.data(), kTestString.size()) ==
+                Crc<TestType>::Combine(
+                    Crc<TestType>::Compute(kTestStringA.data(), kTestStringA.size()),
+                    Crc<TestType>::Compute(kTestStringB.data(), kTestStringB.size()),
+                    kTestStringB.size()));
+
+  const auto message = MakeMessage<1000>();
+  const auto expected = Crc<TestType>::Compute(message.data(), message.size());
+  for (const size_t length_a : {0, 1, 8, 300, 999, 1000}) {
+    CAPTURE(length_a);
+    const size_t length_b = message.size() - length_a;
+    const auto check_value_a = Crc<TestType>::Compute(message.data(), length_a);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto check_value_b = Crc<TestType>::Compute(message.data() + length_a, length_b);
+    CHECK(expected == Crc<TestType>::Combine(check_value_a, check_value_b, length_b));
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Patch CRCs of modified messages",
+                   "[crc]",
+                   Crc6Darc,
+                   Crc7Mmc,
+                   Crc15Can,
+                   Crc24Ble,
+                   Crc24Openpgp,
+                   Crc32Bzip2,
+                   Crc32IsoHdlc,
+                   Crc64Xz) {
+  const auto message = MakeMessage<300>();
+  const auto old_check_value = Crc<TestType>::Compute(message.data(), message.size());
+
+  // Changes at the start, in the middle, and at the end of the message, including empty changes.
+  for (const auto& [offset, length] : {std::pair<size_t, size_t>{0, 1},
+                                       {12, 4},
+                                       {100, 0},
+                                       {37, 150},
+                                       {299, 1},
+                                       {0, 300}}) {
+    CAPTURE(offset, length);
+    std::array<uint8_t, 300> new_message = message;
+    for (size_t i = offset; i < offset + length; i++) {
+      new_message.at(i) ^= static_cast<uint8_t>(i + 1);
+    }
+    CHECK(Crc<TestType>::Compute(new_message.data(), new_message.size()) ==
+          Crc<TestType>::Patch(old_check_value, offset, &message.at(offset),
+                               &new_message.at(offset), length, message.size()));
+  }
+
+  static_assert(Crc<TestType>::Compute("123456789", 9) ==
+                Crc<TestType>::Patch(Crc<TestType>::Compute("123446789", 9), 4, "4", "5", 1, 9));
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Copy and compute CRCs in one pass",
+                   "[crc]",
+                   Crc15Can,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Xz) {
+  // Longer than a copy block, with a partial block at the end.
+  const std::vector<uint8_t> source = MakeMessage(40000);
+  for (const size_t length : {size_t{0}, size_t{1}, size_t{100}, source.size()}) {
+    CAPTURE(length);
+    std::vector<uint8_t> destination(length);
+    Crc<TestType> crc;
+    crc.CopyAndAppend(destination.data(), source.data(), length);
+    CHECK(Crc<TestType>::Compute(source.data(), length) == crc.GetCheckValue());
+    CHECK(std::equal(destination.begin(), destination.end(), source.begin()));
+  }
+
+  static_assert([] {
+    std::array<char, 9> destination{};
+    Crc<TestType> crc;
+    crc.CopyAndAppend(destination.data(), "123456789", destination.size());
+    return crc.GetCheckValue() == Crc<TestType>::Compute("123456789", 9) &&
+           std::string_view(destination.data(), destination.size()) == "123456789";
+  }());
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs of many messages is same as one at a time",
+                   "[crc]",
+                   Crc6Darc,
+                   Crc7Mmc,
+                   Crc15Can,
+                   Crc24Openpgp,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Xz) {
+  const auto buffer = MakeMessage<300>();
+
+  // Messages of different lengths (including empty) and a number that isn't a multiple of the
+  // number of lockstep lanes.
+  std::vector<std::string_view> messages;
+  for (size_t i = 0; i < 29; i++) {
+    const size_t length = (i * 37) % 280;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    messages.emplace_back(reinterpret_cast<const char*>(&buffer.at(i)), length);
+  }
+
+  SECTION("Octet tables") {
+    std::vector<typename Crc<TestType>::RegisterType> check_values(messages.size());
+    Crc<TestType>::ComputeMany(messages, check_values);
+    for (size_t i = 0; i < messages.size(); i++) {
+      CAPTURE(i);
+      CHECK(Crc<TestType>::Compute(messages[i].data(), messages[i].size()) == check_values[i]);
+    }
+  }
+
+  SECTION("Sliced tables") {
+    using SlicedCrc = Crc<TestType, CrcTablePolicy::kSliceBy8>;
+    std::vector<typename SlicedCrc::RegisterType> check_values(messages.size());
+    SlicedCrc::ComputeMany(messages, check_values);
+    for (size_t i = 0; i < messages.size(); i++) {
+      CAPTURE(i);
+      CHECK(Crc<TestType>::Compute(messages[i].data(), messages[i].size()) == check_values[i]);
+    }
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs over segments is same as contiguously",
+                   "[crc]",
+                   Crc7Mmc,
+                   Crc15Can,
+                   Crc24Ble,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Ecma182) {
+  const auto message = MakeMessage<3000>();
+  const auto expected = Crc<TestType>::Compute(message.data(), message.size());
+
+  // Segments shorter and longer than the gathering buffer, empty segments, and ends that aren't
+  // aligned to a block.
+  std::vector<std::span<const uint8_t>> spans;
+  size_t offset = 0;
+  for (const size_t length : {0, 1, 7, 300, 63, 0, 64, 129, 5, 1000, 250, 6, 1}) {
+    spans.emplace_back(&message.at(offset), length);
+    offset += length;
+  }
+  spans.emplace_back(&message.at(offset), message.size() - offset);
+
+  SECTION("Spans") {
+    Crc<TestType> crc;
+    crc.AppendSegments(spans);
+    CHECK(expected == crc.GetCheckValue());
+  }
+
+  SECTION("iovecs") {
+    std::vector<iovec> iovecs;
+    for (const auto span : spans) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      iovecs.push_back({const_cast<uint8_t*>(span.data()), span.size()});
+    }
+    Crc<TestType> crc;
+    crc.AppendSegments(iovecs);
+    CHECK(expected == crc.GetCheckValue());
+  }
+
+  SECTION("Sliced tables") {
+    Crc<TestType, CrcTablePolicy::kSliceBy16> crc;
+    crc.AppendSegments(spans);
+    CHECK(expected == crc.GetCheckValue());
+  }
+
+  SECTION("Constant evaluation") {
+    static constexpr std::array<std::string_view, 3> kSegments = {"1234", "", "56789"};
+    constexpr auto kCheckValue = [] {
+      Crc<TestType> crc;
+      crc.AppendSegments(kSegments);
+      return crc.GetCheckValue();
+    }();
+    static_assert(Crc<TestType>::Compute("123456789", 9) == kCheckValue);
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Verify batches of records",
+                   "[crc]",
+                   Crc7Mmc,
+                   Crc8Bluetooth,
+                   Crc15Can,
+                   Crc16Arc,
+                   Crc16Xmodem,
+                   Crc24Ble,
+                   Crc32IsoHdlc,
+                   Crc64Xz) {
+  constexpr size_t kCheckValueLength = Crc<TestType>::kCheckValueLength;
+  // More records than fit in one mask, and not a whole number of lockstep groups.
+  constexpr size_t kNumRecords = 203;
+  constexpr size_t kNumMasks = (kNumRecords + 63) / 64;
+  for (const size_t record_length :
+       {kCheckValueLength, kCheckValueLength + 3, kCheckValueLength + 11, size_t{16}, size_t{32}}) {
+    CAPTURE(record_length);
+    std::vector<uint8_t> records(record_length * kNumRecords);
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t i = 0; i < kNumRecords; i++) {
+      uint8_t* const record = &records.at(i * record_length);
+      const size_t payload_length = record_length - kCheckValueLength;
+      for (size_t j = 0; j < payload_length; j++) {
+        record[j] = static_cast<uint8_t>(i * 0x9e + j * 0x37);  // NOLINT
+      }
+      const auto check_value = Crc<TestType>::Compute(record, payload_length);
+      for (size_t j = 0; j < kCheckValueLength; j++) {
+        const size_t shift = 8 * (TestType::kReflect ? j : kCheckValueLength - 1 - j);
+        record[payload_length + j] = static_cast<uint8_t>(check_value >> shift);
+      }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::array<uint64_t, kNumMasks> passed{};
+    Crc<TestType>::VerifyRecords(records.data(), record_length, kNumRecords, passed);
+    CHECK(std::array<uint64_t, kNumMasks>{~uint64_t{}, ~uint64_t{}, ~uint64_t{}, 0x7ff} == passed);
+    passed.fill(~uint64_t{});
+    Crc<TestType>::VerifyRecords(records.data(), record_length, 3, passed);
+    CHECK(uint64_t{0b111} == passed[0]);
+    CHECK(~uint64_t{} == passed[1]);
+
+    // Corrupt a payload octet of some records and the check value of others, in full groups and
+    // in the records after the last full group.
+    records.at(5 * record_length) ^= 0x10;
+    records.at(41 * record_length + record_length - 1) ^= 0x01;
+    records.at(130 * record_length + record_length / 2) ^= 0x80;
+    records.at(201 * record_length) ^= 0x04;
+    Crc<TestType>::VerifyRecords(records.data(), record_length, kNumRecords, passed);
+    CHECK(std::array<uint64_t, kNumMasks>{~((uint64_t{1} << 5) | (uint64_t{1} << 41)),
+                                          ~uint64_t{},
+                                          ~(uint64_t{1} << (130 - 128)),
+                                          0x7ff & ~(uint64_t{1} << (201 - 192))} == passed);
+  }
+
+  static_assert([] {
+    std::array<uint64_t, 1> passed = {~uint64_t{}};
+    Crc<TestType>::VerifyRecords("", 0, 1, passed);
+    return passed[0];
+  }() == 0);
+}
+
+TEST_CASE("Compute CRC-32C over messages long enough to interleave", "[crc]") {
+  // Long enough for three 4 KiB blocks plus a partial block.
+  constexpr size_t kMessageLength = 3 * 4096 + 1001;
+
+  // Constant evaluation only uses look-up tables.
+  constexpr auto kExpected = [] {
+    const auto message = MakeMessage<kMessageLength>();
+    return Crc<Crc32Iscsi>::Compute(message.data(), message.size());
+  }();
+  const auto message = MakeMessage<kMessageLength>();
+  CHECK(kExpected == Crc<Crc32Iscsi>::Compute(message.data(), message.size()));
+
+  // Starting from a remainder other than the initial value.
+  Crc<Crc32Iscsi> crc;
+  crc.AppendOctets(message.data(), 5);
+  crc.AppendOctets(&message.at(5), message.size() - 5);
+  CHECK(kExpected == crc.GetCheckValue());
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs over bit spans is same as one bit at a time",
+                   "[crc]",
+                   Crc6Darc,
+                   Crc7Mmc,
+                   Crc8Bluetooth,
+                   Crc15Can,
+                   Crc16Arc,
+                   Crc17CanFd,
+                   Crc21CanFd,
+                   Crc24Ble,
+                   Crc32IsoHdlc,
+                   Crc64Xz) {
+  static constexpr std::array<uint8_t, 6> kMessage = {0xca, 0xfe, 0x91, 0x5a, 0x0f, 0x73};
+  constexpr size_t kMessageBitCount = kMessage.size() * 8;
+  constexpr auto kComputeBitwise = [](size_t bit_offset, size_t bit_count) {
+    Crc<TestType> crc;
+    for (size_t i = bit_offset; i < bit_offset + bit_count; i++) {
+      const uint8_t octet = kMessage.at(i / 8);
+      crc.template AppendBits<1>(TestType::kReflect ? octet >> (i % 8) : octet >> (7 - i % 8));
+    }
+    return crc.GetCheckValue();
+  };
+  constexpr auto kComputeSpan = [](size_t bit_offset, size_t bit_count) {
+    Crc<TestType> crc;
+    crc.AppendBitSpan(kMessage.data(), bit_offset, bit_count);
+    return crc.GetCheckValue();
+  };
+  static_assert(kComputeBitwise(3, 37) == kComputeSpan(3, 37));
+
+  for (size_t bit_offset = 0; bit_offset < kMessageBitCount; bit_offset++) {
+    for (size_t bit_count = 0; bit_offset + bit_count <= kMessageBitCount; bit_count++) {
+      CAPTURE(bit_offset, bit_count);
+      CHECK(kComputeBitwise(bit_offset, bit_count) == kComputeSpan(bit_offset, bit_count));
+    }
+  }
+
+  SECTION("Whole octets") {
+    CHECK(Crc<TestType>::Compute(kMessage.data(), kMessage.size()) ==
+          kComputeSpan(0, kMessageBitCount));
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_LIST_TEST_CASE("Compute CRCs over integer values is same as over their octets",
+                        "[crc]",
+                        CrcCatalogModels) {
+  static constexpr std::array<uint8_t, 8> kOctets = {
+      0xca, 0xfe, 0x91, 0x5a, 0x0f, 0x73, 0x2e, 0xd4};
+  constexpr uint64_t kLittleEndianValue = 0xd42e'730f'5a91'feca;
+  constexpr uint64_t kBigEndianValue = 0xcafe'915a'0f73'2ed4;
+
+  // Appends an arbitrary prefix so that the remainder is nonzero, then each value.
+  constexpr auto kComputeValues = []<CrcTablePolicy TablePolicy>() {
+    Crc<TestType, TablePolicy> crc;
+    crc.AppendOctets(kOctets.data(), 3);
+    crc.template AppendValue<CrcByteOrder::kLittleEndian>(static_cast<uint8_t>(kLittleEndianValue));
+    crc.template AppendValue<CrcByteOrder::kBigEndian>(
+        static_cast<uint16_t>(kBigEndianValue >> 48));
+    crc.template AppendValue<CrcByteOrder::kLittleEndian>(
+        static_cast<uint16_t>(kLittleEndianValue));
+    crc.template AppendValue<CrcByteOrder::kBigEndian>(
+        static_cast<uint32_t>(kBigEndianValue >> 32));
+    crc.template AppendValue<CrcByteOrder::kLittleEndian>(
+        static_cast<uint32_t>(kLittleEndianValue));
+    crc.template AppendValue<CrcByteOrder::kBigEndian>(kBigEndianValue);
+    crc.template AppendValue<CrcByteOrder::kLittleEndian>(kLittleEndianValue);
+    return crc.GetCheckValue();
+  };
+  const auto expected = [] {
+    Crc<TestType> crc;
+    crc.AppendOctets(kOctets.data(), 3);
+    crc.AppendOctets(kOctets.data(), 1);
+    crc.AppendOctets(kOctets.data(), 2);
+    crc.AppendOctets(kOctets.data(), 2);
+    crc.AppendOctets(kOctets.data(), 4);
+    crc.AppendOctets(kOctets.data(), 4);
+    crc.AppendOctets(kOctets.data(), 8);
+    crc.AppendOctets(kOctets.data(), 8);
+    return crc.GetCheckValue();
+  }();
+  static_assert(kComputeValues.template operator()<CrcTablePolicy::kSliceBy8>() ==
+                kComputeValues.template operator()<CrcTablePolicy::kOctet>());
+  CHECK(expected == kComputeValues.template operator()<CrcTablePolicy::kBitwise>());
+  CHECK(expected == kComputeValues.template operator()<CrcTablePolicy::kNibble>());
+  CHECK(expected == kComputeValues.template operator()<CrcTablePolicy::kOctet>());
+  CHECK(expected == kComputeValues.template operator()<CrcTablePolicy::kSliceBy8>());
+  CHECK(expected == kComputeValues.template operator()<CrcTablePolicy::kSliceBy16>());
+
+  SECTION("Multi-octet bit widths") {
+    // Bits of the value in the order that they are shifted in.
+    const auto append_bitwise = [](Crc<TestType, CrcTablePolicy::kSliceBy8>& crc,
+                                   uint64_t value,
+                                   size_t bit_width) {
+      for (size_t i = 0; i < bit_width; i++) {
+        crc.template AppendBits<1>(TestType::kReflect ? value >> i : value >> (bit_width - 1 - i));
+      }
+    };
+    Crc<TestType, CrcTablePolicy::kSliceBy8> crc;
+    crc.template AppendBits<13>(kBigEndianValue);
+    crc.template AppendBits<64>(kBigEndianValue);
+    crc.template AppendBits<35>(kLittleEndianValue);
+    Crc<TestType, CrcTablePolicy::kSliceBy8> bitwise_crc;
+    append_bitwise(bitwise_crc, kBigEndianValue, 13);
+    append_bitwise(bitwise_crc, kBigEndianValue, 64);
+    append_bitwise(bitwise_crc, kLittleEndianValue, 35);
+    CHECK(bitwise_crc.GetCheckValue() == crc.GetCheckValue());
+  }
+
+  SECTION("Bit widths wider than a word") {
+    __extension__ using Uint128 = unsigned __int128;
+    const Uint128 value = (Uint128{kLittleEndianValue} << 64) | kBigEndianValue;
+    Crc<TestType> crc;
+    crc.template AppendBits<72>(value);
+    crc.template AppendBits<128>(value);
+    crc.template AppendBits<5>(value);
+    Crc<TestType> bitwise_crc;
+    for (const size_t bit_width : {size_t{72}, size_t{128}, size_t{5}}) {
+      for (size_t i = 0; i < bit_width; i++) {
+        const size_t shift = TestType::kReflect ? i : bit_width - 1 - i;
+        bitwise_crc.template AppendBits<1>(static_cast<uint8_t>(value >> shift));
+      }
+    }
+    CHECK(bitwise_crc.GetCheckValue() == crc.GetCheckValue());
+  }
+}
+
+// NOLINTNEXTLINE
+TEMPLATE_TEST_CASE("Compute CRCs over fixed-length messages is same as over runtime lengths",
+                   "[crc]",
+                   Crc6Darc,
+                   Crc8Bluetooth,
+                   Crc15Can,
+                   Crc16Xmodem,
+                   Crc17CanFd,
+                   Crc24Ble,
+                   Crc32IsoHdlc,
+                   Crc32Iscsi,
+                   Crc64Ecma182,
+                   Crc64Xz) {
+  static constexpr auto kMessage = MakeMessage<80>();
+
+  // Checks each table policy against the runtime-length overload, both over C arrays and spans.
+  constexpr auto kCheckLength = []<size_t Length>() {
+    std::array<uint8_t, Length> message{};
+    std::copy_n(kMessage.begin(), Length, message.begin());
+    const auto expected = Crc<TestType>::Compute(message.data(), Length);
+    CAPTURE(Length);
+    const std::span<const uint8_t, Length> span(message);
+    CHECK(expected == Crc<TestType, CrcTablePolicy::kBitwise>::Compute(span));
+    CHECK(expected == Crc<TestType, CrcTablePolicy::kOctet>::Compute(std::span(message)));
+    CHECK(expected == Crc<TestType, CrcTablePolicy::kSliceBy8>::Compute(std::span(message)));
+    CHECK(expected == Crc<TestType, CrcTablePolicy::kSliceBy16>::Compute(std::span(message)));
+    uint8_t array[Length];  // NOLINT(modernize-avoid-c-arrays)
+    std::copy_n(message.begin(), Length, array);
+    CHECK(expected == Crc<TestType, CrcTablePolicy::kSliceBy8>::Compute(array));
+  };
+  [&]<size_t... kLengths>(std::index_sequence<kLengths...>) {
+    (kCheckLength.template operator()<kLengths + 1>(), ...);
+  }(std::make_index_sequence<24>());
+  kCheckLength.template operator()<63>();
+  kCheckLength.template operator()<64>();
+  kCheckLength.template operator()<65>();
+  kCheckLength.template operator()<80>();
+
+  // String literals include their null terminator.
+  static_assert(Crc<TestType>::Compute("123456789") == Crc<TestType>::Compute("123456789", 10));
+  static_assert(Crc<TestType, CrcTablePolicy::kSliceBy8>::Compute(std::span(kMessage)) ==
+                Crc<TestType>::Compute(kMessage.data(), kMessage.size()));
+}
+
 TEST_CASE("Compose bit-oriented computation", "[crc]") {
   SECTION("Reflected") {
     using TestType = Crc16Arc;
@@ -0,0 +1,63 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_CRC_TEST_UTIL_H
+#define MAYS_CRC_TEST_UTIL_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "crc.h"
+
+// Helpers shared by the CRC tests and benchmarks. Not part of the library.
+namespace mays {
+
+// Every catalog model, e.g. for TEMPLATE_LIST_TEST_CASE.
+using CrcCatalogModels = std::tuple<Crc6Darc,
+                                    Crc7Mmc,
+                                    Crc8Bluetooth,
+                                    Crc15Can,
+                                    Crc16Arc,
+                                    Crc16Xmodem,
+                                    Crc17CanFd,
+                                    Crc21CanFd,
+                                    Crc24Ble,
+                                    Crc24Openpgp,
+                                    Crc32Bzip2,
+                                    Crc32IsoHdlc,
+                                    Crc32Iscsi,
+                                    Crc64Ecma182,
+                                    Crc64Xz>;
+
+// Returns octet |index| of an arbitrary message that varies from octet to octet and doesn't repeat
+// every 256 octets.
+[[nodiscard]] constexpr uint8_t GetMessageOctet(size_t index) {
+  return static_cast<uint8_t>((index * 0x9e + 0x37) ^ (index >> 8));  // NOLINT
+}
+
+// Returns the first |length| octets of the arbitrary message.
+[[nodiscard]] inline std::vector<uint8_t> MakeMessage(size_t length) {
+  std::vector<uint8_t> message(length);
+  for (size_t i = 0; i < message.size(); i++) {
+    message[i] = GetMessageOctet(i);
+  }
+  return message;
+}
+
+// Returns the first |Length| octets of the arbitrary message, in constant expressions too.
+template <size_t Length>
+[[nodiscard]] constexpr std::array<uint8_t, Length> MakeMessage() {
+  std::array<uint8_t, Length> message{};
+  for (size_t i = 0; i < message.size(); i++) {
+    message[i] = GetMessageOctet(i);
+  }
+  return message;
+}
+
+}  // namespace mays
+
+#endif  // MAYS_CRC_TEST_UTIL_H
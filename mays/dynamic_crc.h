@@ -0,0 +1,242 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_DYNAMIC_CRC_H
+#define MAYS_DYNAMIC_CRC_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include "crc.h"
+#include "internal/check.h"
+
+namespace mays {
+
+// CRC model parameters known only at run time, with the same meanings as those of CrcTraits. All
+// parameters are written higher-power-left in the lowest |polynomial_bit_width| bits.
+struct DynamicCrcParameters {
+  size_t polynomial_bit_width;
+  uint64_t polynomial;
+  uint64_t initial_value;
+  bool reflect;
+  uint64_t output_xor_mask;
+
+  // Returns the parameters of a compile-time model, e.g. FromTraits<Crc32IsoHdlc>().
+  template <typename Traits>
+  [[nodiscard]] static constexpr DynamicCrcParameters FromTraits() {
+    return {Traits::kPolynomialBitWidth,
+            Traits::kPolynomial,
+            Traits::kInitialValue,
+            Traits::kReflect,
+            Traits::kOutputXorMask};
+  }
+};
+
+// Computes a CRC over a message using model parameters given at run time, producing the same check
+// values as Crc<Traits> with the same parameters.
+//
+// Look-up tables are generated when first constructing a DynamicCrc for a given polynomial and
+// shared by all later instances (on any thread) with the same polynomial width, polynomial, and
+// reflection, so constructing and copying instances is cheap. Messages are processed eight octets
+// per iteration with independent look-ups, like Crc with CrcTablePolicy::kSliceBy8.
+//
+// Example:
+//   const DynamicCrc crc_model(DynamicCrcParameters{.polynomial_bit_width = 16,
+//                                                   .polynomial = 0x1021,
+//                                                   .initial_value = 0,
+//                                                   .reflect = false,
+//                                                   .output_xor_mask = 0});
+//   uint64_t check_value = crc_model.Compute("123456789", 9);  // |check_value| is 0x31c3
+//
+// Instances also store the state of a CRC over a series of messages.
+//
+// Example:
+//   DynamicCrc crc(DynamicCrcParameters::FromTraits<Crc16Arc>());
+//   crc.AppendOctets("123", 3);
+//   crc.AppendOctets("456789", 6);
+//   uint64_t check_value = crc.GetCheckValue();  // |check_value| is 0xbb3d
+class DynamicCrc {
+ public:
+  // |parameters.polynomial_bit_width| must be in [1, 64].
+  explicit DynamicCrc(const DynamicCrcParameters& parameters)
+      : parameters_(parameters),
+        tables_(GetTables(parameters)),
+        register_(GetInitialRegister()) {}
+
+  [[nodiscard]] const DynamicCrcParameters& parameters() const { return parameters_; }
+
+  // Computes a check value over a sequence of octets, independent of the state of this instance.
+  // The |Octet| template parameter must be an 8-bit type, e.g. uint8_t, std::byte, char, etc.
+  template <typename Octet>
+  [[nodiscard]] uint64_t Compute(const Octet* data, size_t length) const {
+    return ToCheckValue(ProcessOctets(GetInitialRegister(), data, length));
+  }
+
+  // Restarts the CRC computation from the model's initial value.
+  void Reset() { register_ = GetInitialRegister(); }
+
+  // Processes a sequence of octets through the CRC. May be called multiple times to process parts
+  // of a full sequence. The |Octet| template parameter must be an 8-bit type.
+  template <typename Octet>
+  void AppendOctets(const Octet* data, size_t length) {
+    register_ = ProcessOctets(register_, data, length);
+  }
+
+  // Returns the current CRC check value.
+  [[nodiscard]] uint64_t GetCheckValue() const { return ToCheckValue(register_); }
+
+ private:
+  // Remainder of each octet value followed by zero through seven zero octets. Remainders are
+  // stored in the same orientation as |register_|.
+  struct Tables {
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    uint64_t remainders[8][1 << 8];
+  };
+
+  [[nodiscard]] uint64_t GetMask() const {
+    return ~uint64_t{} >> (64 - parameters_.polynomial_bit_width);
+  }
+
+  [[nodiscard]] uint64_t GetInitialRegister() const {
+    const size_t width = parameters_.polynomial_bit_width;
+    const uint64_t initial_value = parameters_.initial_value & GetMask();
+    return parameters_.reflect ? detail::ReflectBits(initial_value) >> (64 - width)
+                               : initial_value << (64 - width);
+  }
+
+  [[nodiscard]] uint64_t ToCheckValue(uint64_t crc_register) const {
+    const uint64_t remainder = parameters_.reflect
+                                   ? crc_register
+                                   : crc_register >> (64 - parameters_.polynomial_bit_width);
+    return remainder ^ (parameters_.output_xor_mask & GetMask());
+  }
+
+  // Returns |crc_register| after processing |data| through it.
+  template <typename Octet>
+  [[nodiscard]] uint64_t ProcessOctets(uint64_t crc_register,
+                                       const Octet* data,
+                                       size_t length) const {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+    const Tables& tables = *tables_;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (parameters_.reflect) {
+      for (; length >= 8; length -= 8, data += 8) {
+        crc_register = AppendSlice<true>(tables, LoadWord<true>(data) ^ crc_register);
+      }
+      for (size_t i = 0; i < length; i++) {
+        const auto index = static_cast<uint8_t>(crc_register ^ static_cast<uint8_t>(data[i]));
+        crc_register = tables.remainders[0][index] ^ (crc_register >> 8);
+      }
+    } else {
+      for (; length >= 8; length -= 8, data += 8) {
+        crc_register = AppendSlice<false>(tables, LoadWord<false>(data) ^ crc_register);
+      }
+      for (size_t i = 0; i < length; i++) {
+        const auto index =
+            static_cast<uint8_t>((crc_register >> 56) ^ static_cast<uint8_t>(data[i]));
+        crc_register = tables.remainders[0][index] ^ (crc_register << 8);
+      }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return crc_register;
+  }
+
+  // Returns the tables for the model, generating them if no other instance has done so yet.
+  [[nodiscard]] static std::shared_ptr<const Tables> GetTables(
+      const DynamicCrcParameters& parameters) {
+    const size_t width = parameters.polynomial_bit_width;
+    MAYS_CHECK(width >= 1 && width <= 64);
+    const uint64_t polynomial = parameters.polynomial & (~uint64_t{} >> (64 - width));
+
+    // Tables are never evicted, as the number of distinct models in use is expected to be small.
+    using Key = std::tuple<size_t, uint64_t, bool>;
+    static std::mutex mutex;
+    static std::map<Key, std::shared_ptr<const Tables>> cache;
+    const std::lock_guard lock(mutex);
+    std::shared_ptr<const Tables>& tables = cache[Key{width, polynomial, parameters.reflect}];
+    if (tables == nullptr) {
+      tables = GenerateTables(width, polynomial, parameters.reflect);
+    }
+    return tables;
+  }
+
+  // Reflected models keep the remainder in the lowest |width| bits with the highest power on the
+  // right, and unreflected models keep it in the highest |width| bits with the highest power on
+  // the left, so that in either case the next message octet lines up with the end of the register
+  // regardless of |width|.
+  [[nodiscard]] static std::shared_ptr<Tables> GenerateTables(size_t width,
+                                                              uint64_t polynomial,
+                                                              bool reflect) {
+    auto tables = std::make_shared<Tables>();
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    for (uint64_t octet = 0; octet < (1 << 8); octet++) {
+      uint64_t remainder = 0;
+      if (reflect) {
+        const uint64_t reverse_polynomial = detail::ReflectBits(polynomial) >> (64 - width);
+        remainder = octet;
+        for (size_t i = 0; i < 8; i++) {
+          remainder = (remainder >> 1) ^ ((remainder & 1) != 0 ? reverse_polynomial : 0);
+        }
+      } else {
+        const uint64_t aligned_polynomial = polynomial << (64 - width);
+        remainder = octet << 56;
+        for (size_t i = 0; i < 8; i++) {
+          remainder = (remainder << 1) ^ ((remainder >> 63) != 0 ? aligned_polynomial : 0);
+        }
+      }
+      tables->remainders[0][octet] = remainder;
+    }
+    for (size_t slice = 1; slice < 8; slice++) {
+      for (size_t octet = 0; octet < (1 << 8); octet++) {
+        const uint64_t previous = tables->remainders[slice - 1][octet];
+        tables->remainders[slice][octet] =
+            reflect ? tables->remainders[0][previous & 0xff] ^ (previous >> 8)
+                    : tables->remainders[0][previous >> 56] ^ (previous << 8);
+      }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+    return tables;
+  }
+
+  // Loads eight octets into a word in the same orientation as |register_|, such that the first
+  // octet lines up with the end of the register that is shifted out first.
+  template <bool Reflect, typename Octet>
+  [[nodiscard]] static uint64_t LoadWord(const Octet* data) {
+    uint64_t word = 0;
+#pragma GCC unroll 8
+    for (size_t i = 0; i < 8; i++) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const auto octet = uint64_t{static_cast<uint8_t>(data[i])};
+      word |= Reflect ? octet << (8 * i) : octet << (56 - 8 * i);
+    }
+    return word;
+  }
+
+  // Returns the remainder of |word|, which is eight message octets already added to the register,
+  // using one independent look-up per octet.
+  template <bool Reflect>
+  [[nodiscard]] static uint64_t AppendSlice(const Tables& tables, uint64_t word) {
+    uint64_t remainder = 0;
+#pragma GCC unroll 8
+    for (size_t i = 0; i < 8; i++) {
+      const auto octet = static_cast<uint8_t>(Reflect ? word >> (8 * i) : word >> (56 - 8 * i));
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      remainder ^= tables.remainders[7 - i][octet];
+    }
+    return remainder;
+  }
+
+  DynamicCrcParameters parameters_;
+  std::shared_ptr<const Tables> tables_;
+  uint64_t register_;
+};
+
+}  // namespace mays
+
+#endif  // MAYS_DYNAMIC_CRC_H
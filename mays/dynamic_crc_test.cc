@@ -0,0 +1,85 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "dynamic_crc.h"
+
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_test_util.h"
+
+namespace mays {
+namespace {
+
+// NOLINTNEXTLINE
+TEMPLATE_LIST_TEST_CASE("Compute dynamic CRCs is same as compile-time CRCs",
+                        "[dynamic_crc]",
+                        CrcCatalogModels) {
+  const DynamicCrc crc_model(DynamicCrcParameters::FromTraits<TestType>());
+  constexpr std::string_view kCheckInput = "123456789";
+  CHECK(Crc<TestType>::Compute(kCheckInput.data(), kCheckInput.size()) ==
+        crc_model.Compute(kCheckInput.data(), kCheckInput.size()));
+
+  // Long enough to have multiple slices and a partial slice.
+  const std::vector<uint8_t> message = MakeMessage(53);
+  for (size_t length = 0; length <= message.size(); length++) {
+    CAPTURE(length);
+    CHECK(Crc<TestType>::Compute(message.data(), length) ==
+          crc_model.Compute(message.data(), length));
+  }
+
+  SECTION("In parts") {
+    DynamicCrc crc = crc_model;
+    crc.AppendOctets(message.data(), 5);
+    crc.AppendOctets(&message.at(5), message.size() - 5);
+    CHECK(Crc<TestType>::Compute(message.data(), message.size()) == crc.GetCheckValue());
+
+    crc.Reset();
+    crc.AppendOctets(message.data(), message.size());
+    CHECK(Crc<TestType>::Compute(message.data(), message.size()) == crc.GetCheckValue());
+  }
+}
+
+TEST_CASE("Compute dynamic CRCs with parameters outside of the polynomial width", "[dynamic_crc]") {
+  // Bits above the polynomial width are ignored.
+  const DynamicCrc crc_model(DynamicCrcParameters{.polynomial_bit_width = 16,
+                                                  .polynomial = 0xf'1021,
+                                                  .initial_value = 0xf'0000,
+                                                  .reflect = false,
+                                                  .output_xor_mask = 0xf'0000});
+  CHECK(crc_model.Compute("123456789", 9) == Crc<Crc16Xmodem>::Compute("123456789", 9));
+}
+
+TEST_CASE("Compute dynamic CRCs constructed concurrently", "[dynamic_crc]") {
+  // Two models with separate tables (they differ only in reflection), each constructed on several
+  // threads at once to exercise the table cache.
+  const std::vector<uint8_t> message = MakeMessage(1000);
+  std::vector<uint64_t> check_values(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < check_values.size(); i++) {
+    threads.emplace_back([&, i] {
+      const DynamicCrc crc_model(i % 2 == 0 ? DynamicCrcParameters::FromTraits<Crc32Bzip2>()
+                                            : DynamicCrcParameters::FromTraits<Crc32IsoHdlc>());
+      check_values[i] = crc_model.Compute(message.data(), message.size());
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < check_values.size(); i++) {
+    CAPTURE(i);
+    CHECK(check_values[i] ==
+          (i % 2 == 0 ? Crc<Crc32Bzip2>::Compute(message.data(), message.size())
+                      : Crc<Crc32IsoHdlc>::Compute(message.data(), message.size())));
+  }
+}
+
+}  // namespace
+}  // namespace mays
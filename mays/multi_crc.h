@@ -0,0 +1,93 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#ifndef MAYS_MULTI_CRC_H
+#define MAYS_MULTI_CRC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+#include "crc.h"
+
+namespace mays {
+
+// Computes the CRCs of several models over the same message in a single pass, e.g. for formats
+// that carry both a CRC-32 and a CRC-64 of their payload. Each model is processed the same as by
+// Crc<Traits, CrcTablePolicy::kSliceBy8>, and check values are returned as a std::tuple in the
+// order of |Traits|.
+//
+// When every model would be computed using its look-up tables, each eight-octet word of the
+// message is loaded once and fed to every model in the same loop, so the look-up chains of the
+// different models overlap in the CPU. On CPUs that support carry-less multiplication, where each
+// model folds long messages at several octets per cycle, the message is instead processed in blocks
+// small enough to stay in L1 cache, so it is still read from memory only once.
+//
+// Example:
+//   const auto [crc32, crc64] = MultiCrc<Crc32IsoHdlc, Crc64Xz>::Compute(data, size);
+template <typename... Traits>
+class MultiCrc {
+ public:
+  static_assert(sizeof...(Traits) > 0);
+
+  using CheckValues = std::tuple<typename Crc<Traits>::RegisterType...>;
+
+  template <typename Octet>
+  [[nodiscard]] static constexpr CheckValues Compute(const Octet* data, size_t length) {
+    MultiCrc multi_crc;
+    multi_crc.AppendOctets(data, length);
+    return multi_crc.GetCheckValues();
+  }
+
+  constexpr MultiCrc() = default;
+
+  template <typename Octet>
+  constexpr void AppendOctets(const Octet* data, size_t length) {
+    static_assert(sizeof(Octet) == sizeof(uint8_t));
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#if MAYS_CRC_HAS_CLMUL
+    if (!__builtin_is_constant_evaluated() && detail::CpuSupportsClmul()) {
+      for (size_t offset = 0; offset < length; offset += kBlockLength) {
+        const size_t block_length =
+            length - offset < kBlockLength ? length - offset : kBlockLength;
+        std::apply([&](auto&... crcs) { (crcs.AppendOctets(data + offset, block_length), ...); },
+                   crcs_);
+      }
+      return;
+    }
+#endif  // MAYS_CRC_HAS_CLMUL
+
+    for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), data += sizeof(uint64_t)) {
+      uint64_t word = 0;
+#pragma GCC unroll 8
+      for (size_t i = 0; i < sizeof(uint64_t); i++) {
+        word |= uint64_t{static_cast<uint8_t>(data[i])} << (8 * i);
+      }
+      std::apply(
+          [word](auto&... crcs) {
+            (crcs.template AppendValue<CrcByteOrder::kLittleEndian>(word), ...);
+          },
+          crcs_);
+    }
+    std::apply([&](auto&... crcs) { (crcs.AppendOctets(data, length), ...); }, crcs_);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+
+  [[nodiscard]] constexpr CheckValues GetCheckValues() const {
+    return std::apply([](const auto&... crcs) { return CheckValues(crcs.GetCheckValue()...); },
+                      crcs_);
+  }
+
+ private:
+  // Octets processed by every model before moving on, when folding with carry-less
+  // multiplication. Small enough to stay in L1 cache, but long enough to amortize the fixed cost
+  // of the final reduction after folding.
+  static constexpr size_t kBlockLength = size_t{12} << 10;
+
+  std::tuple<Crc<Traits, CrcTablePolicy::kSliceBy8>...> crcs_;
+};
+
+}  // namespace mays
+
+#endif  // MAYS_MULTI_CRC_H
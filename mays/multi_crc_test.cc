@@ -0,0 +1,51 @@
+// (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+// SPDX-License-Identifier: Apache-2.0
+// vim: et:sw=2:ts=2:tw=100
+
+#include "multi_crc.h"
+
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "crc.h"
+#include "crc_test_util.h"
+
+namespace mays {
+namespace {
+
+TEST_CASE("Compute CRCs of several models in one pass", "[multi_crc]") {
+  static_assert(std::is_same_v<std::tuple<uint32_t, uint64_t>,
+                               MultiCrc<Crc32IsoHdlc, Crc64Xz>::CheckValues>);
+  static_assert(MultiCrc<Crc32IsoHdlc, Crc64Xz, Crc15Can>::Compute("123456789", 9) ==
+                std::tuple(uint32_t{0xcbf43926}, uint64_t{0x995dc9bbdf1939fa}, uint16_t{0x059e}));
+
+  // Long enough for several blocks, with a partial block and a partial word at the end.
+  const std::vector<uint8_t> message = MakeMessage((size_t{40} << 10) + 13);
+  for (const size_t length : {size_t{0}, size_t{7}, size_t{8}, size_t{300}, message.size()}) {
+    CAPTURE(length);
+    const auto [crc32, crc64, crc32c, crc17, crc6] =
+        MultiCrc<Crc32IsoHdlc, Crc64Xz, Crc32Iscsi, Crc17CanFd, Crc6Darc>::Compute(message.data(),
+                                                                                  length);
+    CHECK(Crc<Crc32IsoHdlc>::Compute(message.data(), length) == crc32);
+    CHECK(Crc<Crc64Xz>::Compute(message.data(), length) == crc64);
+    CHECK(Crc<Crc32Iscsi>::Compute(message.data(), length) == crc32c);
+    CHECK(Crc<Crc17CanFd>::Compute(message.data(), length) == crc17);
+    CHECK(Crc<Crc6Darc>::Compute(message.data(), length) == crc6);
+  }
+
+  SECTION("In parts") {
+    MultiCrc<Crc16Xmodem, Crc64Ecma182> multi_crc;
+    multi_crc.AppendOctets(message.data(), 5);
+    multi_crc.AppendOctets(message.data() + 5, message.size() - 5);
+    CHECK(std::tuple(Crc<Crc16Xmodem>::Compute(message.data(), message.size()),
+                     Crc<Crc64Ecma182>::Compute(message.data(), message.size())) ==
+          multi_crc.GetCheckValues());
+  }
+}
+
+}  // namespace
+}  // namespace mays
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# (C) Copyright 2026 Xo Wang <xo@geekshavefeelings.com>
+# SPDX-License-Identifier: Apache-2.0
+# vim: et:sw=4:ts=4:tw=100
+"""Converts CRC throughput benchmark results into CSV.
+
+Reads the output of the Catch2 XML reporter for benchmarks named "<operation> <length> octets"
+(see mays/crc_benchmark.cc) and writes one CSV row per benchmark with its mean time, bytes per
+second, and cycles per byte. Rows are sorted so that runs can be compared with diff(1).
+
+Example:
+  build/mays_benchmarks "[throughput]" --reporter XML | tools/crc_benchmark_report.py
+"""
+
+import argparse
+import csv
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+BENCHMARK_NAME_PATTERN = re.compile(r"^(?P<operation>\S+) (?P<length>\d+) octets$")
+
+
+def read_cpu_ghz():
+    """Returns the current frequency of the first CPU from /proc/cpuinfo, or None."""
+    try:
+        with open("/proc/cpuinfo", encoding="utf-8") as cpuinfo:
+            for line in cpuinfo:
+                if line.startswith("cpu MHz"):
+                    return float(line.split(":")[1]) / 1000
+    except OSError:
+        pass
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?", type=argparse.FileType("r"), default=sys.stdin,
+                        help="Catch2 XML reporter output (default: stdin)")
+    parser.add_argument("--cpu-ghz", type=float, default=read_cpu_ghz(),
+                        help="CPU frequency for cycles per byte (default: from /proc/cpuinfo)")
+    args = parser.parse_args()
+
+    rows = []
+    for test_case in ElementTree.parse(args.input).iter("TestCase"):
+        # Template test case names end with the template argument, e.g. "… - Crc32IsoHdlc".
+        model = test_case.get("name").rsplit(" - ", 1)[-1]
+        for result in test_case.iter("BenchmarkResults"):
+            match = BENCHMARK_NAME_PATTERN.match(result.get("name"))
+            if match is None:
+                continue
+            length = int(match["length"])
+            mean_ns = float(result.find("mean").get("value"))
+            cycles_per_byte = f"{mean_ns * args.cpu_ghz / length:.3f}" if args.cpu_ghz else ""
+            rows.append((model, match["operation"], length, mean_ns,
+                         round(length / mean_ns * 1e9), cycles_per_byte))
+
+    writer = csv.writer(sys.stdout)
+    writer.writerow(("model", "operation", "length", "mean_ns", "bytes_per_second",
+                     "cycles_per_byte"))
+    writer.writerows(sorted(rows, key=lambda row: row[:3]))
+
+
+if __name__ == "__main__":
+    main()